@@ -158,9 +158,9 @@ bool FindNodeEnemiesBuilding::accept(const EditorGameBase&, const FCoords& fc) c
 FindEnemyNodeWalkable::FindEnemyNodeWalkable(Player* p, Game& g) : player(p), game(g) {
 }
 
-bool FindEnemyNodeWalkable::accept(const EditorGameBase&, const FCoords& fc) const {
-	return ((fc.field->nodecaps() & MOVECAPS_WALK) && (fc.field->get_owned_by() > 0) &&
-	        player->is_hostile(*game.get_player(fc.field->get_owned_by())));
+bool FindEnemyNodeWalkable::operator()(const FieldColumns& columns, MapIndex const i) const {
+	return ((columns.nodecaps(i) & MOVECAPS_WALK) && (columns.get_owned_by(i) > 0) &&
+	        player->is_hostile(*game.get_player(columns.get_owned_by(i))));
 }
 
 // Sometimes we need to know how many nodes our allies owns
@@ -168,10 +168,10 @@ FindNodeAllyOwned::FindNodeAllyOwned(Player* p, Game& g, PlayerNumber n)
    : player(p), game(g), player_number(n) {
 }
 
-bool FindNodeAllyOwned::accept(const EditorGameBase&, const FCoords& fc) const {
-	return (fc.field->nodecaps() & MOVECAPS_WALK) && (fc.field->get_owned_by() != 0) &&
-	       (fc.field->get_owned_by() != player_number) &&
-	       !player->is_hostile(*game.get_player(fc.field->get_owned_by()));
+bool FindNodeAllyOwned::operator()(const FieldColumns& columns, MapIndex const i) const {
+	return (columns.nodecaps(i) & MOVECAPS_WALK) && (columns.get_owned_by(i) != 0) &&
+	       (columns.get_owned_by(i) != player_number) &&
+	       !player->is_hostile(*game.get_player(columns.get_owned_by(i)));
 }
 
 // When looking for unowned terrain to acquire, we must
@@ -181,29 +181,28 @@ FindNodeUnownedMineable::FindNodeUnownedMineable(Player* p, Game& g, int32_t t)
    : player(p), game(g), ore_type(t) {
 }
 
-bool FindNodeUnownedMineable::accept(const EditorGameBase&, const FCoords& fc) const {
+bool FindNodeUnownedMineable::operator()(const FieldColumns& columns, MapIndex const i) const {
 	if (ore_type == INVALID_INDEX) {
-		return (fc.field->nodecaps() & BUILDCAPS_MINE) && (fc.field->get_owned_by() == neutral());
+		return (columns.nodecaps(i) & BUILDCAPS_MINE) && (columns.get_owned_by(i) == neutral());
 	}
-	return (fc.field->nodecaps() & BUILDCAPS_MINE) && (fc.field->get_owned_by() == neutral()) &&
-	       fc.field->get_resources() == ore_type;
+	return (columns.nodecaps(i) & BUILDCAPS_MINE) && (columns.get_owned_by(i) == neutral()) &&
+	       columns.get_resources(i) == ore_type;
 }
 
 FindNodeUnownedBuildable::FindNodeUnownedBuildable(Player* p, Game& g) : player(p), game(g) {
 }
 
-bool FindNodeUnownedBuildable::accept(const EditorGameBase&, const FCoords& fc) const {
-	return ((fc.field->nodecaps() & BUILDCAPS_SIZEMASK) ||
-	        (fc.field->nodecaps() & BUILDCAPS_MINE)) &&
-	       (fc.field->get_owned_by() == neutral());
+bool FindNodeUnownedBuildable::operator()(const FieldColumns& columns, MapIndex const i) const {
+	return ((columns.nodecaps(i) & BUILDCAPS_SIZEMASK) || (columns.nodecaps(i) & BUILDCAPS_MINE)) &&
+	       (columns.get_owned_by(i) == neutral());
 }
 
 // Unowned but walkable fields nearby
 FindNodeUnownedWalkable::FindNodeUnownedWalkable(Player* p, Game& g) : player(p), game(g) {
 }
 
-bool FindNodeUnownedWalkable::accept(const EditorGameBase&, const FCoords& fc) const {
-	return (fc.field->nodecaps() & MOVECAPS_WALK) && (fc.field->get_owned_by() == neutral());
+bool FindNodeUnownedWalkable::operator()(const FieldColumns& columns, MapIndex const i) const {
+	return (columns.nodecaps(i) & MOVECAPS_WALK) && (columns.get_owned_by(i) == neutral());
 }
 
 // Looking only for mines-capable fields nearby
@@ -29,6 +29,7 @@
 #include "economy/flag.h"
 #include "economy/road.h"
 #include "logic/ai_dna_handler.h"
+#include "logic/field_columns.h"
 #include "logic/game.h"
 #include "logic/map.h"
 #include "logic/map_objects/checkstep.h"
@@ -192,7 +193,7 @@ struct FindNodeEnemiesBuilding {
 struct FindEnemyNodeWalkable {
 	FindEnemyNodeWalkable(Player* p, Game& g);
 
-	bool accept(const EditorGameBase&, const FCoords& fc) const;
+	bool operator()(const FieldColumns&, MapIndex) const;
 
 	Player* player;
 	Game& game;
@@ -202,7 +203,7 @@ struct FindEnemyNodeWalkable {
 struct FindNodeAllyOwned {
 	FindNodeAllyOwned(Player* p, Game& g, PlayerNumber n);
 
-	bool accept(const EditorGameBase&, const FCoords& fc) const;
+	bool operator()(const FieldColumns&, MapIndex) const;
 
 	Player* player;
 	Game& game;
@@ -215,7 +216,7 @@ struct FindNodeAllyOwned {
 struct FindNodeUnownedMineable {
 	FindNodeUnownedMineable(Player* p, Game& g, int32_t t = INVALID_INDEX);
 
-	bool accept(const EditorGameBase&, const FCoords& fc) const;
+	bool operator()(const FieldColumns&, MapIndex) const;
 
 	Player* player;
 	Game& game;
@@ -227,7 +228,7 @@ struct FindNodeUnownedMineable {
 struct FindNodeUnownedBuildable {
 	FindNodeUnownedBuildable(Player* p, Game& g);
 
-	bool accept(const EditorGameBase&, const FCoords& fc) const;
+	bool operator()(const FieldColumns&, MapIndex) const;
 
 	Player* player;
 	Game& game;
@@ -237,7 +238,7 @@ struct FindNodeUnownedBuildable {
 struct FindNodeUnownedWalkable {
 	FindNodeUnownedWalkable(Player* p, Game& g);
 
-	bool accept(const EditorGameBase&, const FCoords& fc) const;
+	bool operator()(const FieldColumns&, MapIndex) const;
 
 	Player* player;
 	Game& game;
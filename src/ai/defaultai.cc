@@ -1384,12 +1384,12 @@ void DefaultAI::update_buildable_field(BuildableField& field) {
 		}
 	}
 
-	field.unowned_land_nearby = map.find_fields(
-	   game(), Area<FCoords>(field.coords, actual_enemy_check_area), nullptr, find_unowned_walkable);
+	field.unowned_land_nearby = map.find_fields_by_columns(
+	   Area<FCoords>(field.coords, actual_enemy_check_area), nullptr, find_unowned_walkable);
 
 	field.enemy_owned_land_nearby =
-	   map.find_fields(game(), Area<FCoords>(field.coords, actual_enemy_check_area), nullptr,
-	                   find_enemy_owned_walkable);
+	   map.find_fields_by_columns(Area<FCoords>(field.coords, actual_enemy_check_area), nullptr,
+	                              find_enemy_owned_walkable);
 
 	field.nearest_buildable_spot_nearby = std::numeric_limits<uint16_t>::max();
 	field.unowned_buildable_spots_nearby = 0;
@@ -1402,11 +1402,11 @@ void DefaultAI::update_buildable_field(BuildableField& field) {
 
 		// first looking for unowned buildable spots
 		field.unowned_buildable_spots_nearby =
-		   map.find_fields(game(), Area<FCoords>(field.coords, kBuildableSpotsCheckArea),
-		                   &found_buildable_fields, find_unowned_buildable);
+		   map.find_fields_by_columns(Area<FCoords>(field.coords, kBuildableSpotsCheckArea),
+		                              &found_buildable_fields, find_unowned_buildable);
 		field.unowned_buildable_spots_nearby +=
-		   map.find_fields(game(), Area<FCoords>(field.coords, kBuildableSpotsCheckArea),
-		                   &found_buildable_fields, find_enemy_owned_walkable);
+		   map.find_fields_by_columns(Area<FCoords>(field.coords, kBuildableSpotsCheckArea),
+		                              &found_buildable_fields, find_enemy_owned_walkable);
 		// Now iterate over fields to collect statistics
 		for (auto& coords : found_buildable_fields) {
 			// We are not interested in blocked fields
@@ -1432,8 +1432,8 @@ void DefaultAI::update_buildable_field(BuildableField& field) {
 	}
 
 	// Is this near the border? Get rid of fields owned by ally
-	if (map.find_fields(game(), Area<FCoords>(field.coords, 3), nullptr, find_ally) ||
-	    map.find_fields(game(), Area<FCoords>(field.coords, 3), nullptr, find_unowned_walkable)) {
+	if (map.find_fields_by_columns(Area<FCoords>(field.coords, 3), nullptr, find_ally) ||
+	    map.find_fields_by_columns(Area<FCoords>(field.coords, 3), nullptr, find_unowned_walkable)) {
 		field.near_border = true;
 	} else {
 		field.near_border = false;
@@ -1451,12 +1451,10 @@ void DefaultAI::update_buildable_field(BuildableField& field) {
 
 	// testing mines
 	if (resource_count_now) {
-		uint32_t close_mines = map.find_fields(
-		   game(), Area<FCoords>(field.coords, kProductionArea), nullptr, find_unowned_mines_pots);
-		uint32_t distant_mines =
-		   map.find_fields(game(), Area<FCoords>(field.coords, kDistantResourcesArea), nullptr,
-
-		                   find_unowned_mines_pots);
+		uint32_t close_mines = map.find_fields_by_columns(
+		   Area<FCoords>(field.coords, kProductionArea), nullptr, find_unowned_mines_pots);
+		uint32_t distant_mines = map.find_fields_by_columns(
+		   Area<FCoords>(field.coords, kDistantResourcesArea), nullptr, find_unowned_mines_pots);
 		distant_mines = distant_mines - close_mines;
 		field.unowned_mines_spots_nearby = 4 * close_mines + distant_mines / 2;
 		if (distant_mines > 0) {
@@ -1469,8 +1467,8 @@ void DefaultAI::update_buildable_field(BuildableField& field) {
 		     mines_per_type[iron_resource_id].finished) <= 1) {
 			// counting iron mines, if we have less than two iron mines
 			field.unowned_iron_mines_nearby =
-			   map.find_fields(game(), Area<FCoords>(field.coords, kDistantResourcesArea), nullptr,
-			                   find_unowned_iron_mines);
+			   map.find_fields_by_columns(Area<FCoords>(field.coords, kDistantResourcesArea),
+			                              nullptr, find_unowned_iron_mines);
 		} else {
 			field.unowned_iron_mines_nearby = 0;
 		}
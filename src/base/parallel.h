@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_BASE_PARALLEL_H
+#define WL_BASE_PARALLEL_H
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <vector>
+
+/// The number of threads that CPU bound work should be spread over. At least 1.
+unsigned nr_worker_threads();
+
+/**
+ * Splits [0, size) into consecutive chunks of at least 'min_chunk_size' elements
+ * and calls 'function(begin, end)' for each chunk, on as many threads as are
+ * useful. The calling thread takes the first chunk. Returns when all chunks are
+ * done; if any of the calls threw, one of the exceptions is rethrown.
+ *
+ * The calls must not touch shared state other than their own range.
+ */
+template <typename Function>
+void parallel_for(size_t size, const Function& function, size_t min_chunk_size = 16384) {
+	const size_t nr_chunks = std::max<size_t>(
+	   1, std::min<size_t>(nr_worker_threads(), size / std::max<size_t>(1, min_chunk_size)));
+	if (nr_chunks == 1) {
+		function(0, size);
+		return;
+	}
+
+	const size_t chunk_size = (size + nr_chunks - 1) / nr_chunks;
+	std::vector<std::future<void>> others;
+	for (size_t begin = chunk_size; begin < size; begin += chunk_size) {
+		const size_t end = std::min(begin + chunk_size, size);
+		others.push_back(
+		   std::async(std::launch::async, [&function, begin, end]() { function(begin, end); }));
+	}
+
+	std::exception_ptr error;
+	try {
+		function(0, chunk_size);
+	} catch (...) {
+		error = std::current_exception();
+	}
+	// Wait for all chunks, even if one failed, since they reference 'function'.
+	for (std::future<void>& other : others) {
+		try {
+			other.get();
+		} catch (...) {
+			if (!error) {
+				error = std::current_exception();
+			}
+		}
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+
+#endif  // end of include guard: WL_BASE_PARALLEL_H
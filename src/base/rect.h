@@ -56,6 +56,13 @@ template <typename T> struct Rect {
 		return Vector2f(x + w / 2.f, y + h / 2.f);
 	}
 
+	bool operator==(const Rect& other) const {
+		return x == other.x && y == other.y && w == other.w && h == other.h;
+	}
+	bool operator!=(const Rect& other) const {
+		return !(*this == other);
+	}
+
 	template <typename Type> Rect<Type> cast() const {
 		return Rect<Type>(Type(x), Type(y), Type(w), Type(h));
 	}
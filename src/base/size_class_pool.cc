@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "base/size_class_pool.h"
+
+constexpr size_t SizeClassPool::kGranularity;
+constexpr size_t SizeClassPool::kNumSizeClasses;
+constexpr size_t SizeClassPool::kBlocksPerChunk;
+
+SizeClassPool::SizeClassPool() {
+	free_lists_.fill(nullptr);
+}
+
+void* SizeClassPool::allocate(size_t const size) {
+	const size_t size_class = get_size_class(size);
+	if (size_class >= kNumSizeClasses) {
+		return ::operator new(size);
+	}
+	if (!free_lists_[size_class]) {
+		refill(size_class);
+	}
+	FreeBlock* block = free_lists_[size_class];
+	free_lists_[size_class] = block->next;
+	return block;
+}
+
+void SizeClassPool::deallocate(void* const ptr, size_t const size) {
+	const size_t size_class = get_size_class(size);
+	if (size_class >= kNumSizeClasses) {
+		::operator delete(ptr);
+		return;
+	}
+	FreeBlock* block = static_cast<FreeBlock*>(ptr);
+	block->next = free_lists_[size_class];
+	free_lists_[size_class] = block;
+}
+
+void SizeClassPool::refill(size_t const size_class) {
+	const size_t block_size = size_class * kGranularity;
+	chunks_.emplace_back(new char[block_size * kBlocksPerChunk]);
+	char* const chunk = chunks_.back().get();
+	// Push in reverse, so that blocks are handed out in address order
+	for (size_t i = kBlocksPerChunk; i > 0; --i) {
+		FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (i - 1) * block_size);
+		block->next = free_lists_[size_class];
+		free_lists_[size_class] = block;
+	}
+}
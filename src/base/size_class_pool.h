@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_BASE_SIZE_CLASS_POOL_H
+#define WL_BASE_SIZE_CLASS_POOL_H
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "base/macros.h"
+
+/**
+ * Free-list allocator for many small objects of a few different sizes.
+ *
+ * Blocks are grouped into size classes, and every size class is carved out of
+ * chunks of its own. Objects of the same type therefore end up close together
+ * in memory, and memory of deleted objects is handed out again to the next
+ * object of the same size without going through the general-purpose
+ * allocator. Requests that are too big for the largest size class are
+ * forwarded to ::operator new.
+ *
+ * Memory is only returned to the system when the pool is destroyed.
+ * The pool is not synchronized.
+ */
+class SizeClassPool {
+public:
+	SizeClassPool();
+
+	void* allocate(size_t size);
+
+	/// 'size' must be the same as for the allocate() call that returned 'ptr'.
+	void deallocate(void* ptr, size_t size);
+
+private:
+	// Block sizes are multiples of this, which also keeps them aligned
+	static constexpr size_t kGranularity = 16;
+	static constexpr size_t kNumSizeClasses = 1024 / kGranularity + 1;
+	static constexpr size_t kBlocksPerChunk = 64;
+
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	static size_t get_size_class(size_t const size) {
+		return (size + kGranularity - 1) / kGranularity;
+	}
+
+	void refill(size_t size_class);
+
+	std::array<FreeBlock*, kNumSizeClasses> free_lists_;
+	std::vector<std::unique_ptr<char[]>> chunks_;
+
+	DISALLOW_COPY_AND_ASSIGN(SizeClassPool);
+};
+
+#endif  // end of include guard: WL_BASE_SIZE_CLASS_POOL_H
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <cstring>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "base/xxh64.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+namespace {
+
+uint64_t hash(const void* data, size_t size, uint64_t seed = 0) {
+	Xxh64 xxh64(seed);
+	xxh64.data(data, size);
+	return xxh64.digest();
+}
+
+uint64_t hash(const char* text) {
+	return hash(text, strlen(text));
+}
+
+// 100 bytes that are not all the same, so that mixing up their order changes the hash
+std::vector<uint8_t> make_input() {
+	std::vector<uint8_t> result;
+	for (unsigned i = 0; i < 100; ++i) {
+		result.push_back(static_cast<uint8_t>(i * 7));
+	}
+	return result;
+}
+
+// Known answers for make_input() with seed 0
+constexpr uint64_t kHash31 = 0x0f187c62b1e722b7ULL;
+constexpr uint64_t kHash32 = 0x91b0cb0931a8c629ULL;
+constexpr uint64_t kHash64 = 0xbf3052e3445775d0ULL;
+constexpr uint64_t kHash100 = 0x8e2272c08247d5dbULL;
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(Xxh64Tests)
+
+BOOST_AUTO_TEST_CASE(known_answers) {
+	// Test vectors of the reference implementation
+	BOOST_CHECK_EQUAL(hash(""), 0xef46db3751d8e999ULL);
+	BOOST_CHECK_EQUAL(hash("a"), 0xd24ec4f1a98c6e5bULL);
+	BOOST_CHECK_EQUAL(hash("abc"), 0x44bc2cf5ad770999ULL);
+	BOOST_CHECK_EQUAL(hash("The quick brown fox jumps over the lazy dog"), 0x0b242d361fda71bcULL);
+
+	const std::vector<uint8_t> input = make_input();
+	BOOST_CHECK_EQUAL(hash(input.data(), 31), kHash31);
+	BOOST_CHECK_EQUAL(hash(input.data(), 32), kHash32);
+	BOOST_CHECK_EQUAL(hash(input.data(), 64), kHash64);
+	BOOST_CHECK_EQUAL(hash(input.data(), input.size()), kHash100);
+	BOOST_CHECK_EQUAL(hash(input.data(), input.size(), 12345), 0x65193c8e88f402dfULL);
+}
+
+BOOST_AUTO_TEST_CASE(split_updates_give_the_same_hash) {
+	const std::vector<uint8_t> input = make_input();
+
+	// Two parts, split at every position, including right at the stripe boundaries
+	for (size_t split = 0; split <= input.size(); ++split) {
+		Xxh64 xxh64;
+		xxh64.data(input.data(), split);
+		xxh64.data(input.data() + split, input.size() - split);
+		BOOST_CHECK_EQUAL(xxh64.digest(), kHash100);
+		BOOST_CHECK_EQUAL(xxh64.size(), input.size());
+	}
+
+	// Byte by byte
+	Xxh64 xxh64;
+	for (uint8_t byte : input) {
+		xxh64.data(&byte, 1);
+	}
+	BOOST_CHECK_EQUAL(xxh64.digest(), kHash100);
+
+	// Three parts, the middle one fills the buffer and crosses a stripe boundary
+	for (size_t first = 1; first < 32; ++first) {
+		for (size_t second : {31 - first, 32 - first, 33 - first, 40 - first, 65 - first}) {
+			xxh64.reset();
+			xxh64.data(input.data(), first);
+			xxh64.data(input.data() + first, second);
+			xxh64.data(input.data() + first + second, input.size() - first - second);
+			BOOST_CHECK_EQUAL(xxh64.digest(), kHash100);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(digest_does_not_disturb_hashing) {
+	const std::vector<uint8_t> input = make_input();
+	Xxh64 xxh64;
+	xxh64.data(input.data(), 20);
+	xxh64.data(input.data() + 20, 11);
+	BOOST_CHECK_EQUAL(xxh64.digest(), kHash31);
+	xxh64.data(input.data() + 31, 1);
+	BOOST_CHECK_EQUAL(xxh64.digest(), kHash32);
+
+	// A copy continues independently
+	Xxh64 copy = xxh64;
+	copy.data(input.data() + 32, 32);
+	BOOST_CHECK_EQUAL(copy.digest(), kHash64);
+	xxh64.data(input.data() + 32, 68);
+	BOOST_CHECK_EQUAL(xxh64.digest(), kHash100);
+	BOOST_CHECK_EQUAL(copy.digest(), kHash64);
+
+	// Reset with a seed
+	xxh64.reset(12345);
+	BOOST_CHECK_EQUAL(xxh64.size(), 0U);
+	xxh64.data(input.data(), input.size());
+	BOOST_CHECK_EQUAL(xxh64.digest(), 0x65193c8e88f402dfULL);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
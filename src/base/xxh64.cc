@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "base/xxh64.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint64_t kPrime1 = 11400714785074694791ULL;
+constexpr uint64_t kPrime2 = 14029467366897019727ULL;
+constexpr uint64_t kPrime3 = 1609587929392839161ULL;
+constexpr uint64_t kPrime4 = 9650029242287828579ULL;
+constexpr uint64_t kPrime5 = 2870177450012600261ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+// Compilers turn these into single loads on little endian machines
+inline uint64_t read_64(const uint8_t* p) {
+	return static_cast<uint64_t>(p[0]) | static_cast<uint64_t>(p[1]) << 8 |
+	       static_cast<uint64_t>(p[2]) << 16 | static_cast<uint64_t>(p[3]) << 24 |
+	       static_cast<uint64_t>(p[4]) << 32 | static_cast<uint64_t>(p[5]) << 40 |
+	       static_cast<uint64_t>(p[6]) << 48 | static_cast<uint64_t>(p[7]) << 56;
+}
+
+inline uint32_t read_32(const uint8_t* p) {
+	return static_cast<uint32_t>(p[0]) | static_cast<uint32_t>(p[1]) << 8 |
+	       static_cast<uint32_t>(p[2]) << 16 | static_cast<uint32_t>(p[3]) << 24;
+}
+
+inline uint64_t round(uint64_t acc, uint64_t input) {
+	acc += input * kPrime2;
+	acc = rotl(acc, 31);
+	return acc * kPrime1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t value) {
+	acc ^= round(0, value);
+	return acc * kPrime1 + kPrime4;
+}
+
+// Processes one stripe of 32 bytes
+inline void process_stripe(uint64_t* acc, const uint8_t* p) {
+	acc[0] = round(acc[0], read_64(p));
+	acc[1] = round(acc[1], read_64(p + 8));
+	acc[2] = round(acc[2], read_64(p + 16));
+	acc[3] = round(acc[3], read_64(p + 24));
+}
+
+}  // namespace
+
+Xxh64::Xxh64(uint64_t const seed) {
+	reset(seed);
+}
+
+void Xxh64::reset(uint64_t const seed) {
+	seed_ = seed;
+	acc_[0] = seed + kPrime1 + kPrime2;
+	acc_[1] = seed + kPrime2;
+	acc_[2] = seed;
+	acc_[3] = seed - kPrime1;
+	total_size_ = 0;
+	buffer_size_ = 0;
+}
+
+void Xxh64::data(const void* const newdata, size_t size) {
+	const uint8_t* p = static_cast<const uint8_t*>(newdata);
+	total_size_ += size;
+
+	// Complete a stripe that was started by the last call
+	if (buffer_size_ > 0) {
+		const size_t missing = kStripeSize - buffer_size_;
+		if (size < missing) {
+			memcpy(buffer_ + buffer_size_, p, size);
+			buffer_size_ += size;
+			return;
+		}
+		memcpy(buffer_ + buffer_size_, p, missing);
+		process_stripe(acc_, buffer_);
+		p += missing;
+		size -= missing;
+		buffer_size_ = 0;
+	}
+
+	// Whole stripes are taken directly from the input
+	uint64_t acc[4] = {acc_[0], acc_[1], acc_[2], acc_[3]};
+	for (; size >= kStripeSize; p += kStripeSize, size -= kStripeSize) {
+		process_stripe(acc, p);
+	}
+	memcpy(acc_, acc, sizeof(acc));
+
+	memcpy(buffer_, p, size);
+	buffer_size_ = size;
+}
+
+uint64_t Xxh64::digest() const {
+	uint64_t h;
+	if (total_size_ >= kStripeSize) {
+		h = rotl(acc_[0], 1) + rotl(acc_[1], 7) + rotl(acc_[2], 12) + rotl(acc_[3], 18);
+		for (uint64_t acc : acc_) {
+			h = merge_round(h, acc);
+		}
+	} else {
+		h = seed_ + kPrime5;
+	}
+	h += total_size_;
+
+	const uint8_t* p = buffer_;
+	size_t size = buffer_size_;
+	for (; size >= 8; p += 8, size -= 8) {
+		h ^= round(0, read_64(p));
+		h = rotl(h, 27) * kPrime1 + kPrime4;
+	}
+	if (size >= 4) {
+		h ^= static_cast<uint64_t>(read_32(p)) * kPrime1;
+		h = rotl(h, 23) * kPrime2 + kPrime3;
+		p += 4;
+		size -= 4;
+	}
+	for (; size > 0; ++p, --size) {
+		h ^= *p * kPrime5;
+		h = rotl(h, 11) * kPrime1;
+	}
+
+	h ^= h >> 33;
+	h *= kPrime2;
+	h ^= h >> 29;
+	h *= kPrime3;
+	h ^= h >> 32;
+	return h;
+}
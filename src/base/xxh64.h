@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_BASE_XXH64_H
+#define WL_BASE_XXH64_H
+
+#include <cstddef>
+
+#include <stdint.h>
+
+/**
+ * A streaming implementation of the non-cryptographic XXH64 hash function,
+ * see https://github.com/Cyan4973/xxHash. The input is read as little endian,
+ * so the hash is the same on all platforms.
+ *
+ * It is much faster than MD5 for large inputs, but offers no protection
+ * against deliberate collisions.
+ *
+ * Instances of this class can be copied to take an intermediate hash.
+ */
+class Xxh64 {
+public:
+	explicit Xxh64(uint64_t seed = 0);
+
+	/// Reset the hashing machinery to its initial state.
+	void reset(uint64_t seed = 0);
+
+	/// Consumes new data. Complete stripes of 32 bytes are processed right away,
+	/// the rest is buffered.
+	void data(const void* newdata, size_t size);
+
+	/// The hash of all data consumed since the last reset. More data can be
+	/// consumed afterwards.
+	uint64_t digest() const;
+
+	/// The number of bytes consumed since the last reset.
+	uint64_t size() const {
+		return total_size_;
+	}
+
+private:
+	static constexpr size_t kStripeSize = 32;
+
+	uint64_t acc_[4];
+	uint64_t total_size_;
+	uint8_t buffer_[kStripeSize];
+	size_t buffer_size_;
+	uint64_t seed_;
+};
+
+#endif  // end of include guard: WL_BASE_XXH64_H
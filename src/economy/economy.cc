@@ -19,7 +19,9 @@
 
 #include "economy/economy.h"
 
+#include <algorithm>
 #include <memory>
+#include <tuple>
 #include <unordered_set>
 
 #include <boost/bind.hpp>
@@ -41,6 +43,22 @@
 
 namespace Widelands {
 
+namespace {
+
+// Minimum number of requests at the same flag for which the distances to that
+// flag are calculated once per balancing run, instead of searching a route for
+// each request
+constexpr uint32_t kMinRequestsForDistanceField = 3;
+
+// Minimum number of flags in an economy for which the router uses landmarks.
+// On small networks, plain searches are cheap enough.
+constexpr size_t kMinFlagsForLandmarks = 64;
+
+// Maximum number of routes remembered by each economy
+constexpr size_t kRouteCacheSize = 256;
+
+}  // namespace
+
 Serial Economy::last_economy_serial_ = 0;
 
 void Economy::initialize_serial() {
@@ -52,7 +70,13 @@ Economy::Economy(Player& player) : Economy(player, last_economy_serial_++) {
 }
 
 Economy::Economy(Player& player, Serial init_serial)
-   : serial_(init_serial), owner_(player), request_timerid_(0), options_window_(nullptr) {
+   : serial_(init_serial),
+     owner_(player),
+     request_timerid_(0),
+     options_window_(nullptr),
+     congestion_generation_(0),
+     route_cache_hits_(0),
+     route_cache_misses_(0) {
 	last_economy_serial_ = std::max(last_economy_serial_, serial_ + 1);
 	const TribeDescr& tribe = player.tribe();
 	DescriptionIndex const nr_wares = player.egbase().tribes().nrwares();
@@ -91,6 +115,9 @@ Economy::~Economy() {
 		log("Warning: Economy still has flags left on destruction\n");
 	if (warehouses_.size())
 		log("Warning: Economy still has warehouses left on destruction\n");
+	if (route_cache_hits_ || route_cache_misses_)
+		log("Economy %u: route cache had %u hits and %u misses\n", serial_, route_cache_hits_,
+		    route_cache_misses_);
 
 	delete[] ware_target_quantities_;
 	delete[] worker_target_quantities_;
@@ -119,6 +146,10 @@ void Economy::check_merge(Flag& f1, Flag& f2) {
 		if (e1->get_nrflags() < e2->get_nrflags())
 			std::swap(e1, e2);
 		e1->merge(*e2);
+	} else if (e1) {
+		// A new connection inside the economy might be a shortcut
+		e1->router_->invalidate_landmarks();
+		e1->invalidate_route_cache();
 	}
 }
 
@@ -135,6 +166,8 @@ void Economy::check_split(Flag& f1, Flag& f2) {
 	if (!e)
 		return;
 
+	// The connection is already gone, even if the economy is only split later
+	e->invalidate_route_cache();
 	e->split_checks_.push_back(std::make_pair(OPtr<Flag>(&f1), OPtr<Flag>(&f2)));
 	e->rebalance_supply();  // the real split-checking is done during rebalance
 }
@@ -195,15 +228,87 @@ void Economy::check_splits() {
 /**
  * Calculate a route between two flags.
  *
- * This functionality has been moved to Router(). This is currently
- * merely a delegator.
+ * The actual search is done by the Router(). Since the same routes are asked
+ * for over and over again (wares and workers recalculate their route at every
+ * flag), complete routes are remembered until the road network changes.
+ * Ware routes also depend on the number of wares waiting on the flags, so they
+ * are only reused while that has not changed anywhere in the economy.
+ *
+ * Searches with a cost cutoff may give up before finding the route a complete
+ * search would find, so they always bypass the cache.
  */
 bool Economy::find_route(
    Flag& start, Flag& end, Route* const route, WareWorker const type, int32_t const cost_cutoff) {
 	assert(start.get_economy() == this);
 	assert(end.get_economy() == this);
-	return router_->find_route(
-	   start, end, route, type, cost_cutoff, *owner().egbase().mutable_map());
+	update_landmarks();
+
+	Map& map = *owner().egbase().mutable_map();
+	if (cost_cutoff >= 0) {
+		return router_->find_route(start, end, route, type, cost_cutoff, map);
+	}
+
+	const RouteCacheKey key(start.serial(), end.serial(), type);
+	auto cached = route_cache_index_.find(key);
+	if (cached != route_cache_index_.end()) {
+		std::list<CachedRoute>::iterator entry = cached->second;
+		if (type == wwWORKER || entry->congestion_generation == congestion_generation_) {
+			++route_cache_hits_;
+			route_cache_.splice(route_cache_.begin(), route_cache_, entry);
+			if (route) {
+				*route = entry->route;
+			}
+			return true;
+		}
+		route_cache_.erase(entry);
+		route_cache_index_.erase(cached);
+	}
+
+	++route_cache_misses_;
+	Route found;
+	if (!router_->find_route(start, end, &found, type, -1, map)) {
+		return false;
+	}
+	if (route) {
+		*route = found;
+	}
+	route_cache_.push_front(CachedRoute{key, congestion_generation_, found});
+	route_cache_index_[key] = route_cache_.begin();
+
+	if (route_cache_.size() > kRouteCacheSize) {
+		route_cache_index_.erase(route_cache_.back().key);
+		route_cache_.pop_back();
+	}
+	return true;
+}
+
+/**
+ * Forget all cached routes. Called whenever roads, flags or ship connections
+ * change.
+ */
+void Economy::invalidate_route_cache() {
+	route_cache_.clear();
+	route_cache_index_.clear();
+}
+
+/**
+ * Recalculate the landmarks of the router if they have been invalidated by
+ * new connections and the economy is large enough to benefit from them.
+ */
+void Economy::update_landmarks() {
+	if (router_->landmarks_valid() || flags_.size() < kMinFlagsForLandmarks) {
+		return;
+	}
+
+	// The order of flags_ depends on the history of the economy, so sort by serial
+	// to make the choice of landmarks reproducible after loading a game.
+	std::vector<Flag*> sorted_flags(flags_);
+	std::sort(sorted_flags.begin(), sorted_flags.end(),
+	          [](const Flag* a, const Flag* b) { return a->serial() < b->serial(); });
+	router_->calc_landmarks(std::vector<RoutingNode*>(sorted_flags.begin(), sorted_flags.end()));
+
+	// Routes found with the old estimates might differ from new search results
+	invalidate_route_cache();
 }
 
 struct ZeroEstimator {
@@ -262,6 +367,7 @@ void Economy::add_flag(Flag& flag) {
 
 	flags_.push_back(&flag);
 	flag.set_economy(this);
+	invalidate_route_cache();
 
 	flag.reset_path_finding_cycle();
 }
@@ -287,6 +393,8 @@ void Economy::remove_flag(Flag& flag) {
  */
 void Economy::do_remove_flag(Flag& flag) {
 	flag.set_economy(nullptr);
+	router_->remove_node(flag);
+	invalidate_route_cache();
 
 	// fast remove
 	for (Flags::iterator flag_iter = flags_.begin(); flag_iter != flags_.end(); ++flag_iter) {
@@ -547,6 +655,7 @@ void Economy::merge(Economy& e) {
 		e.do_remove_flag(flag);  // do not delete other economy yet!
 		add_flag(flag);
 	}
+	router_->invalidate_landmarks();
 
 	// Remember that the other economy may not have been connected before the merge
 	split_checks_.insert(split_checks_.end(), e.split_checks_.begin(), e.split_checks_.end());
@@ -598,13 +707,10 @@ void Economy::start_request_timer(int32_t const delta) {
 Supply* Economy::find_best_supply(Game& game, const Request& req, int32_t& cost) {
 	assert(req.is_open());
 
-	Route buf_route0, buf_route1;
-	Supply* best_supply = nullptr;
-	Route* best_route = nullptr;
-	int32_t best_cost = -1;
 	Flag& target_flag = req.target_flag();
 
 	available_supplies_.clear();
+	supply_flags_.clear();
 
 	for (size_t i = 0; i < supplies_.get_nrsupplies(); ++i) {
 		Supply& supp = supplies_[i];
@@ -613,56 +719,67 @@ Supply* Economy::find_best_supply(Game& game, const Request& req, int32_t& cost)
 		if (!supp.nr_supplies(game, req))
 			continue;
 
-		const SupplyProviders provider = supp.provider_type(&game);
-
 		// We generally ignore disponible wares on ship as it is not possible to reliably
 		// calculate route (transportation time)
-		if (provider == SupplyProviders::kShip) {
+		if (supp.provider_type(&game) == SupplyProviders::kShip) {
 			continue;
 		}
 
-		const Widelands::Coords provider_position =
-		   supp.get_position(game)->base_flag().get_position();
+		Flag& provider_flag = supp.get_position(game)->base_flag();
 
-		const uint32_t dist = game.map().calc_distance(target_flag.get_position(), provider_position);
+		// std::map guarantees uniqueness, practically it means that if more supplies are on the
+		// same flag, only the first one will be considered
+		if (available_supplies_.insert(std::make_pair(provider_flag.serial(), &supp)).second) {
+			supply_flags_.push_back(&provider_flag);
+		}
+	}
 
-		UniqueDistance ud = {dist, supp.get_position(game)->serial(), provider};
+	if (supply_flags_.empty())
+		return nullptr;
 
-		// std::map quarantees uniqueness, practically it means that if more wares are on the same
-		// flag, only
-		// first one will be inserted into available_supplies
-		available_supplies_.insert(std::make_pair(ud, &supplies_[i]));
-	}
+	// If several requests are waiting at the same flag, compute the distances
+	// to it once and look up the best supply for each of them.
+	const DistanceFieldKey target(target_flag.serial(), req.get_type());
+	const auto group = requests_per_target_.find(target);
+	if (group != requests_per_target_.end() && group->second >= kMinRequestsForDistanceField) {
+		auto field = distance_fields_.find(target);
+		if (field == distance_fields_.end()) {
+			field = distance_fields_.insert(std::make_pair(target, Router::DistanceField())).first;
+			router_->calc_distances_to(target_flag, req.get_type(), &field->second);
+		}
 
-	// Now available supplies have been sorted by distance to requestor
-	for (auto& supplypair : available_supplies_) {
-		Supply& supp = *supplypair.second;
-
-		Route* const route = best_route != &buf_route0 ? &buf_route0 : &buf_route1;
-		// will be cleared by find_route()
-
-		if (!find_route(
-		       supp.get_position(game)->base_flag(), target_flag, route, req.get_type(), best_cost)) {
-			if (!best_route) {
-				log("Economy::find_best_supply: Error, COULD NOT FIND A ROUTE!");
-				// To help to debug this a bit:
-				log(" ... ware at: %3dx%3d, requestor at: %3dx%3d!",
-				    supp.get_position(game)->base_flag().get_position().x,
-				    supp.get_position(game)->base_flag().get_position().y, target_flag.get_position().x,
-				    target_flag.get_position().y);
+		RoutingNode* best_flag = nullptr;
+		for (RoutingNode* supply_flag : supply_flags_) {
+			const auto distance = field->second.find(supply_flag);
+			if (distance != field->second.end() && (!best_flag || distance->second < cost)) {
+				best_flag = supply_flag;
+				cost = distance->second;
 			}
-			continue;
 		}
-		best_supply = &supp;
-		best_route = route;
-		best_cost = route->get_totalcost();
+		if (!best_flag) {
+			log("Economy::find_best_supply: Error, COULD NOT FIND A ROUTE!");
+			return nullptr;
+		}
+		return available_supplies_.at(best_flag->base_flag().serial());
 	}
 
-	if (!best_route)
+	// Search from all candidate flags at once, the first one to reach the
+	// requestor is the one with the cheapest route.
+	update_landmarks();
+	Route route;
+	RoutingNode* const best_flag =
+	   router_->find_route_from_any(supply_flags_, target_flag, &route, req.get_type(), -1,
+	                                *game.mutable_map());
+	if (!best_flag) {
+		log("Economy::find_best_supply: Error, COULD NOT FIND A ROUTE!");
+		// To help to debug this a bit:
+		log(" ... requestor at: %3dx%3d, %" PRIuS " candidate flags!", target_flag.get_position().x,
+		    target_flag.get_position().y, supply_flags_.size());
 		return nullptr;
+	}
 
-	cost = best_cost;
-	return best_supply;
+	cost = route.get_totalcost();
+	return available_supplies_.at(best_flag->base_flag().serial());
 }
 
 struct RequestSupplyPair {
@@ -701,6 +818,12 @@ struct RSPairStruct {
  * Walk all Requests and find potential transfer candidates.
  */
 void Economy::process_requests(Game& game, RSPairStruct* supply_pairs) {
+	requests_per_target_.clear();
+	distance_fields_.clear();
+	for (const Request* req : requests_) {
+		++requests_per_target_[DistanceFieldKey(req->target_flag().serial(), req->get_type())];
+	}
+
 	// Algorithm can decide that wares are not to be delivered to constructionsite
 	// right now, therefore we need to shcedule next pairing
 	bool postponed_pairing_needed = false;
@@ -753,6 +876,9 @@ void Economy::process_requests(Game& game, RSPairStruct* supply_pairs) {
 
 		supply_pairs->queue.push(rsp);
 	}
+	// The distance fields become stale as soon as wares start moving
+	requests_per_target_.clear();
+	distance_fields_.clear();
 	if (postponed_pairing_needed && supply_pairs->nexttimer < 0) {
 		// so no other pair set the timer, so we set them now for after 30 seconds
 		supply_pairs->nexttimer = 30 * 1000;
@@ -986,6 +1112,10 @@ void Economy::handle_active_supplies(Game& game) {
 	using Assignments = std::vector<std::pair<Supply*, Warehouse*>>;
 	Assignments assignments;
 
+	// Many active supplies of the same type wait on the same flag, so remember
+	// the warehouses we found instead of searching again for each of them.
+	std::map<std::tuple<Serial, WareWorker, DescriptionIndex>, Warehouse*> closest_warehouses;
+
 	for (uint32_t idx = 0; idx < supplies_.get_nrsupplies(); ++idx) {
 		Supply& supply = supplies_[idx];
 		if (supply.has_storage())
@@ -1033,10 +1163,18 @@ void Economy::handle_active_supplies(Game& game) {
 		if (preferred_wh) {
 			wh = preferred_wh;
 		} else {
-			wh = find_closest_warehouse(supply.get_position(game)->base_flag(), type, nullptr, 0,
-			                            (!havenormal) ? WarehouseAcceptFn() :
-			                                            boost::bind(&accept_warehouse_if_policy, _1,
-			                                                        type, ware, StockPolicy::kNormal));
+			Flag& flag = supply.get_position(game)->base_flag();
+			const auto key = std::make_tuple(flag.serial(), type, ware);
+			const auto cached = closest_warehouses.find(key);
+			if (cached != closest_warehouses.end()) {
+				wh = cached->second;
+			} else {
+				wh = find_closest_warehouse(flag, type, nullptr, 0,
+				                            (!havenormal) ? WarehouseAcceptFn() :
+				                                            boost::bind(&accept_warehouse_if_policy, _1,
+				                                                        type, ware, StockPolicy::kNormal));
+				closest_warehouses.insert(std::make_pair(key, wh));
+			}
 		}
 		if (!wh) {
 			log("Warning: Economy::handle_active_supplies "
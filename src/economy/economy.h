@@ -20,14 +20,19 @@
 #ifndef WL_ECONOMY_ECONOMY_H
 #define WL_ECONOMY_ECONOMY_H
 
+#include <list>
+#include <map>
 #include <memory>
 #include <set>
+#include <tuple>
 #include <vector>
 
 #include <boost/function.hpp>
 #include <boost/utility.hpp>
 
 #include "base/macros.h"
+#include "economy/route.h"
+#include "economy/router.h"
 #include "economy/supply.h"
 #include "economy/supply_list.h"
 #include "logic/map_objects/map_object.h"
@@ -45,8 +50,7 @@ class Warehouse;
 struct Flag;
 struct RSPairStruct;
 class Request;
-struct Route;
-struct Router;
+struct RoutingNode;
 struct Supply;
 class Economy;
 
@@ -127,6 +131,20 @@ public:
 
 	bool find_route(Flag& start, Flag& end, Route* route, WareWorker type, int32_t cost_cutoff = -1);
 
+	/// Number of find_route() calls that were answered from the route cache
+	uint32_t route_cache_hits() const {
+		return route_cache_hits_;
+	}
+	/// Number of find_route() calls that needed a new search
+	uint32_t route_cache_misses() const {
+		return route_cache_misses_;
+	}
+	/// Called by flags when the number of wares on them changes,
+	/// which affects the cost of ware routes.
+	void flag_congestion_changed() {
+		++congestion_generation_;
+	}
+
 	using WarehouseAcceptFn = boost::function<bool(Warehouse&)>;
 	Warehouse* find_closest_warehouse(Flag& start,
 	                                  WareWorker type = wwWORKER,
@@ -221,26 +239,13 @@ protected:
 	static Serial last_economy_serial_;
 
 private:
-	// This structs is to store distance from supply to request(or), but to allow unambiguous
-	// sorting if distances are the same, we use also serial number of provider and type of provider
-	// (flag,
-	// warehouse)
-	struct UniqueDistance {
-		bool operator<(const UniqueDistance& other) const {
-			return std::forward_as_tuple(distance, serial, provider_type) <
-			       std::forward_as_tuple(other.distance, other.serial, other.provider_type);
-		}
-
-		uint32_t distance;
-		uint32_t serial;
-		SupplyProviders provider_type;
-	};
-
 	/*************/
 	/* Functions */
 	/*************/
 	void do_remove_flag(Flag&);
 	void reset_all_pathfinding_cycles();
+	void update_landmarks();
+	void invalidate_route_cache();
 
 	void merge(Economy&);
 	void check_splits();
@@ -295,8 +300,30 @@ private:
 	// may change when merging while the window is open, so we have to keep track of it here.
 	void* options_window_;
 
-	// 'list' of unique providers
-	std::map<UniqueDistance, Supply*> available_supplies_;
+	// 'list' of unique providers, by the serial of the flag they are located at
+	std::map<Serial, Supply*> available_supplies_;
+	// Flags of available_supplies_, in the order they were found
+	std::vector<RoutingNode*> supply_flags_;
+
+	// Open requests and the distances towards them, grouped by target flag and
+	// ware/worker type. Only valid during process_requests().
+	using DistanceFieldKey = std::pair<Serial, WareWorker>;
+	std::map<DistanceFieldKey, uint32_t> requests_per_target_;
+	std::map<DistanceFieldKey, Router::DistanceField> distance_fields_;
+
+	// Most recently used routes, see find_route(). Routes for wares are only
+	// valid as long as the congestion_generation_ has not changed.
+	using RouteCacheKey = std::tuple<Serial, Serial, WareWorker>;
+	struct CachedRoute {
+		RouteCacheKey key;
+		uint32_t congestion_generation;
+		Route route;
+	};
+	std::list<CachedRoute> route_cache_;  // most recently used first
+	std::map<RouteCacheKey, std::list<CachedRoute>::iterator> route_cache_index_;
+	uint32_t congestion_generation_;
+	uint32_t route_cache_hits_;
+	uint32_t route_cache_misses_;
 
 	DISALLOW_COPY_AND_ASSIGN(Economy);
 };
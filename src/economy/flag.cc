@@ -260,6 +260,22 @@ BaseImmovable::PositionList Flag::get_positions(const EditorGameBase&) const {
  * \return neighbouring flags.
  */
 void Flag::get_neighbours(WareWorker type, RoutingNodeNeighbours& neighbours) {
+	collect_neighbours(type, neighbours, false);
+}
+
+/**
+ * \return neighbouring flags, with the costs of getting from them to this flag.
+ */
+void Flag::get_reverse_neighbours(WareWorker type, RoutingNodeNeighbours& neighbours) {
+	collect_neighbours(type, neighbours, true);
+}
+
+/**
+ * Helper for \ref get_neighbours and \ref get_reverse_neighbours.
+ * Roads can have different costs for each direction; ship connections
+ * between ports cost the same both ways.
+ */
+void Flag::collect_neighbours(WareWorker type, RoutingNodeNeighbours& neighbours, bool reverse) {
 	for (int8_t i = 0; i < 6; ++i) {
 		Road* const road = roads_[i];
 		if (!road) {
@@ -269,10 +285,10 @@ void Flag::get_neighbours(WareWorker type, RoutingNodeNeighbours& neighbours) {
 		Flag* f = &road->get_flag(Road::FlagEnd);
 		int32_t nb_cost;
 		if (f != this) {
-			nb_cost = road->get_cost(Road::FlagStart);
+			nb_cost = road->get_cost(reverse ? Road::FlagEnd : Road::FlagStart);
 		} else {
 			f = &road->get_flag(Road::FlagStart);
-			nb_cost = road->get_cost(Road::FlagEnd);
+			nb_cost = road->get_cost(reverse ? Road::FlagStart : Road::FlagEnd);
 		}
 		if (type == wwWARE) {
 			nb_cost += nb_cost * (get_waitcost() + f->get_waitcost()) / 2;
@@ -368,6 +384,9 @@ void Flag::add_ware(EditorGameBase& egbase, WareInstance& ware) {
 	assert(ware_filled_ < ware_capacity_);
 
 	PendingWare& pi = wares_[ware_filled_++];
+	if (Economy* e = get_economy()) {
+		e->flag_congestion_changed();
+	}
 	pi.ware = &ware;
 	pi.pending = false;
 	pi.nextstep = nullptr;
@@ -536,6 +555,9 @@ WareInstance* Flag::fetch_pending_ware(Game& game, PlayerImmovable& dest) {
 	--ware_filled_;
 	memmove(&wares_[best_index], &wares_[best_index + 1],
 	        sizeof(wares_[0]) * (ware_filled_ - best_index));
+	if (Economy* e = get_economy()) {
+		e->flag_congestion_changed();
+	}
 
 	ware->set_location(game, nullptr);
 
@@ -612,6 +634,9 @@ void Flag::remove_ware(EditorGameBase& egbase, WareInstance* const ware) {
 
 		--ware_filled_;
 		memmove(&wares_[i], &wares_[i + 1], sizeof(wares_[0]) * (ware_filled_ - i));
+		if (Economy* e = get_economy()) {
+			e->flag_congestion_changed();
+		}
 
 		if (upcast(Game, game, &egbase)) {
 			wake_up_capacity_queue(*game);
@@ -96,6 +96,7 @@ struct Flag : public PlayerImmovable, public RoutingNode {
 	}
 	PositionList get_positions(const EditorGameBase&) const override;
 	void get_neighbours(WareWorker type, RoutingNodeNeighbours&) override;
+	void get_reverse_neighbours(WareWorker type, RoutingNodeNeighbours&) override;
 	int32_t get_waitcost() const {
 		return ware_filled_;
 	}
@@ -168,6 +169,8 @@ protected:
 	void set_flag_position(Coords coords);
 
 private:
+	void collect_neighbours(WareWorker type, RoutingNodeNeighbours&, bool reverse);
+
 	struct PendingWare {
 		WareInstance* ware;              ///< the ware itself
 		bool pending;                    ///< if the ware is pending
@@ -257,13 +257,10 @@ void Fleet::cleanup(EditorGameBase& egbase) {
 	}
 	portpaths_.clear();
 
+	// Ship::cleanup calls remove_ship, so every ship that is still listed here is alive, also
+	// while EditorGameBase::cleanup_objects() removes the ships and fleets in arbitrary order
 	while (!ships_.empty()) {
-		Ship* ship = ships_.back();
-		// Check if the ship still exists to avoid heap-use-after-free when ship has already been
-		// deleted while processing EditorGameBase::cleanup_objects()
-		if (egbase.objects().object_still_available(ship)) {
-			ship->set_fleet(nullptr);
-		}
+		ships_.back()->set_fleet(nullptr);
 		ships_.pop_back();
 	}
 
@@ -301,34 +298,64 @@ const Fleet::PortPath& Fleet::portpath_bidir(uint32_t i, uint32_t j, bool& rever
 }
 
 /**
- * Find the two docks in the fleet, and fill in the path between them.
+ * Find the two docks in the fleet, and look up the path between them, connecting
+ * the start dock first if necessary.
  *
- * @return true if successful, or false if the docks are not actually part of the fleet.
+ * @return the path, or nullptr if the docks are not actually part of the fleet or
+ * not connected. If @p reverse is set, the stored path leads from @p end to @p start.
  */
-bool Fleet::get_path(const PortDock& start, const PortDock& end, Path& path) {
+const Fleet::PortPath*
+Fleet::find_portpath(const PortDock& start, const PortDock& end, bool* reverse) {
 	uint32_t startidx = std::find(ports_.begin(), ports_.end(), &start) - ports_.begin();
 	uint32_t endidx = std::find(ports_.begin(), ports_.end(), &end) - ports_.begin();
 
 	if (startidx >= ports_.size() || endidx >= ports_.size())
-		return false;
+		return nullptr;
 
-	bool reverse;
-	const PortPath& pp(portpath_bidir(startidx, endidx, reverse));
+	const PortPath& pp(portpath_bidir(startidx, endidx, *reverse));
 
 	if (pp.cost < 0) {
 		connect_port(get_owner()->egbase(), startidx);
 	}
 
 	if (pp.cost < 0)
+		return nullptr;
+
+	return &pp;
+}
+
+/**
+ * Find the two docks in the fleet, and fill in the path between them.
+ *
+ * @return true if successful, or false if the docks are not actually part of the fleet.
+ */
+bool Fleet::get_path(const PortDock& start, const PortDock& end, Path& path) {
+	bool reverse;
+	const PortPath* pp = find_portpath(start, end, &reverse);
+	if (pp == nullptr)
 		return false;
 
-	path = *pp.path;
+	path = *pp->path;
 	if (reverse)
 		path.reverse();
 
 	return true;
 }
 
+/**
+ * Like @ref get_path, but only fill in the number of steps, which does not need a
+ * copy of the path. @p nsteps is left alone if there is no path.
+ */
+bool Fleet::get_path_length(const PortDock& start, const PortDock& end, uint32_t* nsteps) {
+	bool reverse;
+	const PortPath* pp = find_portpath(start, end, &reverse);
+	if (pp == nullptr)
+		return false;
+
+	*nsteps = pp->path->get_nsteps();
+	return true;
+}
+
 uint32_t Fleet::count_ships() const {
 	return ships_.size();
 }
@@ -649,20 +676,22 @@ bool Fleet::penalize_route(Game& game, PortDock& p, const Ship& s, uint32_t* rou
 	uint32_t best_index = std::numeric_limits<uint32_t>::max();
 	for (const auto& pair : s.destinations_) {
 		PortDock* pd = pair.first.get(game);
-		Path path;
+		uint32_t nsteps = 0;
 		uint32_t detour;
 		if (iterator == &p) {
 			detour = 0;
 		} else if (iterator) {
-			get_path(*iterator, p, path);
-			detour = path.get_nsteps();
+			get_path_length(*iterator, p, &nsteps);
+			detour = nsteps;
 		} else {
+			Path path;
 			s.calculate_sea_route(game, p, &path);
-			detour = path.get_nsteps();
+			nsteps = path.get_nsteps();
+			detour = nsteps;
 		}
 		if (&p != pd) {
-			get_path(p, *pd, path);
-			detour += path.get_nsteps();
+			get_path_length(p, *pd, &nsteps);
+			detour += nsteps;
 		}
 		if (detour < shortest_detour) {
 			shortest_detour = detour;
@@ -736,10 +765,7 @@ void Fleet::act(Game& game, uint32_t /* data */) {
 					if (cur_port == p) {  // Same port
 						route_length = 0;
 					} else {  // Different port
-						Path precalculated_path;
-						if (get_path(*cur_port, *p, precalculated_path)) {
-							route_length = precalculated_path.get_nsteps();
-						}
+						get_path_length(*cur_port, *p, &route_length);
 					}
 				}
 			}
@@ -858,9 +884,9 @@ void Fleet::check_push_destination(Game& game,
                                    PortDock& destination,
                                    uint32_t penalty_factor) {
 	assert(!ship.has_destination(game, destination));
-	Path path;
-	get_path(from_port, destination, path);
-	const uint32_t direct_route = path.get_nsteps();
+	uint32_t nsteps = 0;
+	get_path_length(from_port, destination, &nsteps);
+	const uint32_t direct_route = nsteps;
 	assert(direct_route);
 	uint32_t malus = 1;
 	uint32_t shortest_detour = std::numeric_limits<uint32_t>::max();
@@ -880,16 +906,16 @@ void Fleet::check_push_destination(Game& game,
 			uint32_t detour = 0;
 
 			assert(iterator != pd);
-			get_path(*iterator, *pd, path);
-			const uint32_t base_length = path.get_nsteps();
+			get_path_length(*iterator, *pd, &nsteps);
+			const uint32_t base_length = nsteps;
 
 			assert(iterator != &destination);
-			get_path(*iterator, destination, path);
-			detour += path.get_nsteps();
+			get_path_length(*iterator, destination, &nsteps);
+			detour += nsteps;
 
 			assert(pd != &destination);
-			get_path(destination, *pd, path);
-			detour += path.get_nsteps();
+			get_path_length(destination, *pd, &nsteps);
+			detour += nsteps;
 
 			detour -= std::min(detour, base_length);
 			if (detour < shortest_detour) {
@@ -100,6 +100,7 @@ struct Fleet : MapObject {
 	void log_general_info(const EditorGameBase&) const override;
 
 	bool get_path(const PortDock& start, const PortDock& end, Path& path);
+	bool get_path_length(const PortDock& start, const PortDock& end, uint32_t* nsteps);
 	void add_neighbours(PortDock& pd, std::vector<RoutingNodeNeighbour>& neighbours);
 
 	uint32_t count_ships() const;
@@ -115,6 +116,7 @@ private:
 	bool merge(EditorGameBase& egbase, Fleet* other);
 	void check_merge_economy();
 	void connect_port(EditorGameBase& egbase, uint32_t idx);
+	const PortPath* find_portpath(const PortDock& start, const PortDock& end, bool* reverse);
 
 	PortPath& portpath(uint32_t i, uint32_t j);
 	const PortPath& portpath(uint32_t i, uint32_t j) const;
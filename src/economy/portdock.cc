@@ -53,7 +53,11 @@ PortdockDescr::PortdockDescr(char const* const init_name, char const* const init
 }
 
 PortDock::PortDock(Warehouse* wh)
-   : PlayerImmovable(g_portdock_descr), fleet_(nullptr), warehouse_(wh), expedition_ready_(false) {
+   : PlayerImmovable(g_portdock_descr),
+     fleet_(nullptr),
+     warehouse_(wh),
+     warehouse_serial_(wh ? wh->serial() : 0),
+     expedition_ready_(false) {
 }
 
 PortDock::~PortDock() {
@@ -167,7 +171,7 @@ void PortDock::cleanup(EditorGameBase& egbase) {
 
 	Warehouse* wh = nullptr;
 
-	if (egbase.objects().object_still_available(warehouse_)) {
+	if (egbase.objects().object_still_available(warehouse_, warehouse_serial_)) {
 
 		// We need to remember this for possible recreation of portdock
 		wh = warehouse_;
@@ -398,10 +402,10 @@ void PortDock::load_wares(Game& game, Ship& ship) {
 			load_item = dc->second;
 		} else {
 			uint32_t time = ship.estimated_arrival_time(game, *dest);
-			Path direct_route;
-			fleet_->get_path(*this, *dest, direct_route);
+			uint32_t direct_route = 0;
+			fleet_->get_path_length(*this, *dest, &direct_route);
 			if (time == kInvalidDestination) {
-				time = direct_route.get_nsteps();
+				time = direct_route;
 			}
 			for (const OPtr<Ship>& ship_ptr : ships_coming_) {
 				Ship* s = ship_ptr.get(game);
@@ -412,7 +416,7 @@ void PortDock::load_wares(Game& game, Ship& ship) {
 					t = s->estimated_arrival_time(game, *this);
 					assert(s->count_destinations() >= 1);
 					if (time >
-					    t + static_cast<int32_t>(direct_route.get_nsteps() * s->count_destinations())) {
+					    t + static_cast<int32_t>(direct_route * s->count_destinations())) {
 						time = kInvalidDestination;
 						break;
 					}
@@ -587,6 +591,7 @@ void PortDock::Loader::load_pointers() {
 
 	PortDock& pd = get<PortDock>();
 	pd.warehouse_ = &mol().get<Warehouse>(warehouse_);
+	pd.warehouse_serial_ = pd.warehouse_->serial();
 
 	for (Serial s : ships_coming_) {
 		pd.ships_coming_.insert(OPtr<Ship>(&mol().get<Ship>(s)));
@@ -147,6 +147,7 @@ private:
 
 	Fleet* fleet_;
 	Warehouse* warehouse_;
+	Serial warehouse_serial_;  ///< to check whether 'warehouse_' still exists
 	PositionList dockpoints_;
 	std::list<ShippingItem> waiting_;
 	std::set<OPtr<Ship>> ships_coming_;
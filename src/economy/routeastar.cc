@@ -25,8 +25,8 @@
 
 namespace Widelands {
 
-BaseRouteAStar::BaseRouteAStar(Router& router, WareWorker type)
-   : type_(type), mpf_cycle(router.assign_cycle()) {
+BaseRouteAStar::BaseRouteAStar(Router& router, WareWorker type, RouteDirection direction)
+   : type_(type), direction_(direction), mpf_cycle(router.assign_cycle()) {
 }
 
 /**
@@ -39,6 +39,7 @@ void BaseRouteAStar::routeto(RoutingNode& to, IRoute& route) {
 		throw wexception("BaseRouteAStar::routeto should not have an active cookie.");
 	}
 	assert(to.mpf_cycle == mpf_cycle);
+	assert(direction_ == RouteDirection::kForward);
 
 	route.init(to.mpf_realcost);
 	for (RoutingNode* node = &to; node; node = node->mpf_backlink)
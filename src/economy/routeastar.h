@@ -28,14 +28,21 @@ namespace Widelands {
 struct IRoute;
 struct Router;
 
+/**
+ * Whether a search follows the roads in the direction of travel, i.e. from the
+ * pushed nodes towards the nodes found by the search, or against it.
+ */
+enum class RouteDirection { kForward, kReverse };
+
 struct BaseRouteAStar {
-	BaseRouteAStar(Router& router, WareWorker type);
+	BaseRouteAStar(Router& router, WareWorker type, RouteDirection direction);
 
 	void routeto(RoutingNode& to, IRoute& route);
 
 protected:
 	RoutingNode::Queue open_;
 	WareWorker type_;
+	RouteDirection direction_;
 	RoutingNodeNeighbours neighbours_;
 	uint32_t mpf_cycle;
 };
@@ -63,6 +70,10 @@ protected:
  * }
  * @endcode
  *
+ * A search with @ref RouteDirection::kReverse computes the costs of getting
+ * from each found node to the pushed nodes instead. @ref routeto is then not
+ * meaningful, since the backlinks point in the direction of travel.
+ *
  * @warning It is currently impossible to have two RouteAStar instances
  * running concurrently.
  *
@@ -75,7 +86,10 @@ protected:
 template <typename Est_> struct RouteAStar : BaseRouteAStar {
 	using Estimator = Est_;
 
-	RouteAStar(Router& router, WareWorker type, const Estimator& est = Estimator());
+	RouteAStar(Router& router,
+	           WareWorker type,
+	           const Estimator& est = Estimator(),
+	           RouteDirection direction = RouteDirection::kForward);
 
 	void push(RoutingNode& node, int32_t cost = 0, RoutingNode* backlink = nullptr);
 	RoutingNode* step();
@@ -90,8 +104,11 @@ private:
  * seen node.
  */
 template <typename Est_>
-RouteAStar<Est_>::RouteAStar(Router& router, WareWorker type, const Estimator& est)
-   : BaseRouteAStar(router, type), estimator_(est) {
+RouteAStar<Est_>::RouteAStar(Router& router,
+                             WareWorker type,
+                             const Estimator& est,
+                             RouteDirection direction)
+   : BaseRouteAStar(router, type, direction), estimator_(est) {
 }
 
 /**
@@ -127,7 +144,11 @@ template <typename Est_> RoutingNode* RouteAStar<Est_>::step() {
 	RoutingNode* current = open_.top();
 	open_.pop(current);
 
-	current->get_neighbours(type_, neighbours_);
+	if (direction_ == RouteDirection::kForward) {
+		current->get_neighbours(type_, neighbours_);
+	} else {
+		current->get_reverse_neighbours(type_, neighbours_);
+	}
 
 	for (RoutingNodeNeighbour& temp_neighbour : neighbours_) {
 		RoutingNode& neighbour = *temp_neighbour.get_neighbour();
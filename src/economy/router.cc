@@ -19,6 +19,7 @@
 
 #include "economy/router.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
@@ -30,10 +31,47 @@
 
 namespace Widelands {
 
+constexpr size_t Router::kNumLandmarks;
+
+/**
+ * This estimator, for use with @ref RouteAStar, uses the larger of the
+ * straight-line estimate and the landmark lower bound of the router.
+ * Without landmarks, it behaves exactly like @ref AStarEstimator.
+ */
+struct Router::LandmarkEstimator {
+	LandmarkEstimator(const Router& router, ITransportCostCalculator& calc, RoutingNode& dest)
+	   : router_(router), straight_(calc, dest), dest_distances_(nullptr) {
+		if (router_.nr_landmarks_) {
+			auto it = router_.landmark_distances_.find(&dest);
+			if (it != router_.landmark_distances_.end()) {
+				dest_distances_ = &it->second;
+			}
+		}
+	}
+
+	int32_t operator()(RoutingNode& current) const {
+		int32_t estimate = straight_(current);
+		if (dest_distances_) {
+			auto it = router_.landmark_distances_.find(&current);
+			if (it != router_.landmark_distances_.end()) {
+				estimate =
+				   std::max(estimate, router_.lower_bound(it->second, *dest_distances_));
+			}
+		}
+		return estimate;
+	}
+
+private:
+	const Router& router_;
+	AStarEstimator straight_;
+	const LandmarkDistances* dest_distances_;
+};
+
 /*************************************************************************/
 /*                         Router Implementation                         */
 /*************************************************************************/
-Router::Router(const ResetCycleFn& reset) : reset_(reset), mpf_cycle(0) {
+Router::Router(const ResetCycleFn& reset)
+   : reset_(reset), mpf_cycle(0), landmarks_valid_(false), nr_landmarks_(0) {
 }
 
 uint32_t Router::assign_cycle() {
@@ -73,7 +111,8 @@ bool Router::find_route(RoutingNode& start,
                         WareWorker const type,
                         int32_t const cost_cutoff,
                         ITransportCostCalculator& cost_calculator) {
-	RouteAStar<AStarEstimator> astar(*this, type, AStarEstimator(cost_calculator, end));
+	RouteAStar<LandmarkEstimator> astar(
+	   *this, type, LandmarkEstimator(*this, cost_calculator, end));
 
 	astar.push(start);
 
@@ -92,4 +131,209 @@ bool Router::find_route(RoutingNode& start,
 	return false;
 }
 
+/**
+ * Calculate the cheapest route from any of several nodes to a common end node.
+ *
+ * All \p starts are seeded into a single A-star search towards \p end, so that
+ * choosing between many candidate nodes costs one search instead of one search
+ * per candidate. Since the search runs in the direction of travel, the
+ * direction-dependent road costs are taken into account correctly.
+ *
+ * \note route will be init()ed before storing the result.
+ *
+ * \param starts candidate start nodes; duplicates are allowed
+ * \param end, route, type, cost_cutoff, cost_calculator see \ref find_route
+ *
+ * \return the start node from which the cheapest route originates, or nullptr
+ * if no route has been found
+ */
+RoutingNode* Router::find_route_from_any(const std::vector<RoutingNode*>& starts,
+                                         RoutingNode& end,
+                                         IRoute* const route,
+                                         WareWorker const type,
+                                         int32_t const cost_cutoff,
+                                         ITransportCostCalculator& cost_calculator) {
+	RouteAStar<LandmarkEstimator> astar(
+	   *this, type, LandmarkEstimator(*this, cost_calculator, end));
+
+	for (RoutingNode* start : starts) {
+		astar.push(*start);
+	}
+
+	while (RoutingNode* current = astar.step()) {
+		if (cost_cutoff >= 0 && current->mpf_realcost > cost_cutoff)
+			return nullptr;
+
+		if (current == &end) {
+			if (route)
+				astar.routeto(end, *route);
+
+			// The start nodes are the only ones without a backlink
+			RoutingNode* start = &end;
+			while (start->mpf_backlink)
+				start = start->mpf_backlink;
+			return start;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Calculate the cost of the cheapest route from every node that can reach
+ * \p end to \p end, by running a Dijkstra search against the direction of travel.
+ *
+ * This is worthwhile when many routes to the same node need to be compared,
+ * since looking up a distance is then much cheaper than a route search.
+ *
+ * \param end the common end point of all routes
+ * \param type whether the routes are calculated for a ware or a worker
+ * \param distances will be cleared and filled with the costs. Nodes that
+ *        cannot reach \p end have no entry.
+ */
+void Router::calc_distances_to(RoutingNode& end, WareWorker const type, DistanceField* distances) {
+	calc_distances(end, type, true, distances);
+}
+
+/**
+ * Fill \p distances with the costs of the cheapest routes from \p node to all
+ * other nodes, or from all other nodes to \p node if \p reverse is true.
+ */
+void Router::calc_distances(RoutingNode& node,
+                            WareWorker const type,
+                            bool const reverse,
+                            DistanceField* distances) {
+	distances->clear();
+
+	RouteAStar<AStarZeroEstimator> dijkstra(
+	   *this, type, AStarZeroEstimator(),
+	   reverse ? RouteDirection::kReverse : RouteDirection::kForward);
+	dijkstra.push(node);
+
+	while (RoutingNode* current = dijkstra.step()) {
+		distances->insert(std::make_pair(current, current->mpf_realcost));
+	}
+}
+
+/**
+ * Choose up to \ref kNumLandmarks landmarks among \p nodes and calculate the
+ * worker route costs between every node and every landmark.
+ *
+ * The landmarks are picked greedily, each one as far away from the previous
+ * ones as possible. Ties are broken by the order of \p nodes, so the caller
+ * must pass them in a deterministic order.
+ *
+ * Worker costs are used because ware costs are never cheaper, so the bounds
+ * are valid for both.
+ */
+void Router::calc_landmarks(const std::vector<RoutingNode*>& nodes) {
+	landmark_distances_.clear();
+	nr_landmarks_ = 0;
+	landmarks_valid_ = true;
+
+	if (nodes.empty()) {
+		return;
+	}
+
+	DistanceField from_landmark;
+	DistanceField to_landmark;
+
+	// Distance from each node to the closest landmark picked so far. Before the
+	// first landmark, we measure from the first node instead.
+	std::vector<int32_t> closest(nodes.size(), -1);
+	calc_distances(*nodes.front(), wwWORKER, false, &from_landmark);
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		LandmarkDistances& distances = landmark_distances_[nodes[i]];
+		distances.fill(-1);
+		auto it = from_landmark.find(nodes[i]);
+		if (it != from_landmark.end()) {
+			closest[i] = it->second;
+		}
+	}
+
+	while (nr_landmarks_ < kNumLandmarks) {
+		RoutingNode* landmark = nullptr;
+		int32_t farthest = 0;
+		for (size_t i = 0; i < nodes.size(); ++i) {
+			if (closest[i] > farthest) {
+				landmark = nodes[i];
+				farthest = closest[i];
+			}
+		}
+		if (!landmark) {
+			// Network too small to make use of more landmarks
+			break;
+		}
+
+		calc_distances(*landmark, wwWORKER, false, &from_landmark);
+		calc_distances(*landmark, wwWORKER, true, &to_landmark);
+		for (size_t i = 0; i < nodes.size(); ++i) {
+			LandmarkDistances& distances = landmark_distances_[nodes[i]];
+			auto it = from_landmark.find(nodes[i]);
+			if (it != from_landmark.end()) {
+				distances[nr_landmarks_] = it->second;
+				closest[i] = std::min(closest[i], it->second);
+			}
+			it = to_landmark.find(nodes[i]);
+			if (it != to_landmark.end()) {
+				distances[kNumLandmarks + nr_landmarks_] = it->second;
+			}
+		}
+		++nr_landmarks_;
+	}
+}
+
+/**
+ * Forget the landmarks. This must be called whenever a new connection between
+ * nodes is made, because it might make the lower bounds too large.
+ */
+void Router::invalidate_landmarks() {
+	landmarks_valid_ = false;
+	nr_landmarks_ = 0;
+	landmark_distances_.clear();
+}
+
+/**
+ * Forget the landmark distances of a node that is being removed from the network.
+ * Removing nodes only makes routes more expensive, so the other bounds remain valid.
+ */
+void Router::remove_node(const RoutingNode& node) {
+	landmark_distances_.erase(&node);
+}
+
+/**
+ * \return a lower bound for the cost of a route from \p from to \p to, or 0 if
+ * no landmarks are available for them.
+ */
+int32_t Router::landmark_lower_bound(const RoutingNode& from, const RoutingNode& to) const {
+	if (!nr_landmarks_) {
+		return 0;
+	}
+	auto from_it = landmark_distances_.find(&from);
+	auto to_it = landmark_distances_.find(&to);
+	if (from_it == landmark_distances_.end() || to_it == landmark_distances_.end()) {
+		return 0;
+	}
+	return lower_bound(from_it->second, to_it->second);
+}
+
+/**
+ * Apply the triangle inequality to the landmark distances of two nodes.
+ */
+int32_t Router::lower_bound(const LandmarkDistances& from, const LandmarkDistances& to) const {
+	int32_t bound = 0;
+	for (size_t i = 0; i < nr_landmarks_; ++i) {
+		// landmark -> to is not cheaper than landmark -> from -> to
+		if (from[i] >= 0 && to[i] >= 0) {
+			bound = std::max(bound, to[i] - from[i]);
+		}
+		// from -> landmark is not cheaper than from -> to -> landmark
+		const size_t j = kNumLandmarks + i;
+		if (from[j] >= 0 && to[j] >= 0) {
+			bound = std::max(bound, from[j] - to[j]);
+		}
+	}
+	return bound;
+}
+
 }  // namespace Widelands
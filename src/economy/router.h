@@ -19,6 +19,8 @@
 #ifndef WL_ECONOMY_ROUTER_H
 #define WL_ECONOMY_ROUTER_H
 
+#include <array>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/function.hpp>
@@ -34,9 +36,22 @@ struct RoutingNode;
 /**
  * This class finds the best route between Nodes (Flags) in an economy.
  * The functionality was split from Economy
+ *
+ * To speed up searches on large networks, the router can precompute the
+ * distances between all nodes and a few landmark nodes, see \ref calc_landmarks.
+ * By the triangle inequality, these give lower bounds for the cost between any
+ * two nodes, which guide the searches much better than the straight-line
+ * distance. The bounds remain valid when roads are removed or when ware
+ * routes become more expensive due to congestion, so they only need to be
+ * recalculated when new connections are made.
  */
 struct Router {
 	using ResetCycleFn = boost::function<void()>;
+	/// Cost of the cheapest route from each reachable node to a common end node
+	using DistanceField = std::unordered_map<const RoutingNode*, int32_t>;
+
+	/// Number of landmarks used for the lower bounds
+	static constexpr size_t kNumLandmarks = 4;
 
 	explicit Router(const ResetCycleFn& reset);
 
@@ -46,11 +61,41 @@ struct Router {
 	                WareWorker type,
 	                int32_t cost_cutoff,
 	                ITransportCostCalculator& cost_calculator);
+	RoutingNode* find_route_from_any(const std::vector<RoutingNode*>& starts,
+	                                 RoutingNode& end,
+	                                 IRoute* route,
+	                                 WareWorker type,
+	                                 int32_t cost_cutoff,
+	                                 ITransportCostCalculator& cost_calculator);
+	void calc_distances_to(RoutingNode& end, WareWorker type, DistanceField* distances);
 	uint32_t assign_cycle();
 
+	void calc_landmarks(const std::vector<RoutingNode*>& nodes);
+	void invalidate_landmarks();
+	void remove_node(const RoutingNode& node);
+	bool landmarks_valid() const {
+		return landmarks_valid_;
+	}
+	int32_t landmark_lower_bound(const RoutingNode& from, const RoutingNode& to) const;
+
 private:
+	/// Costs from each landmark to a node, followed by the costs from the
+	/// node to each landmark. Negative if there is no route.
+	using LandmarkDistances = std::array<int32_t, 2 * kNumLandmarks>;
+	struct LandmarkEstimator;
+
+	void calc_distances(RoutingNode& node,
+	                    WareWorker type,
+	                    bool reverse,
+	                    DistanceField* distances);
+	int32_t lower_bound(const LandmarkDistances& from, const LandmarkDistances& to) const;
+
 	ResetCycleFn reset_;
 	uint32_t mpf_cycle;  ///< pathfinding cycle, see Flag::mpf_cycle
+
+	bool landmarks_valid_;
+	size_t nr_landmarks_;
+	std::unordered_map<const RoutingNode*, LandmarkDistances> landmark_distances_;
 };
 }  // namespace Widelands
 #endif  // end of include guard: WL_ECONOMY_ROUTER_H
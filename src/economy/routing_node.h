@@ -91,6 +91,9 @@ public:
 
 	virtual Flag& base_flag() = 0;
 	virtual void get_neighbours(WareWorker type, RoutingNodeNeighbours&) = 0;
+	/// Like get_neighbours, but the costs are those of getting from each
+	/// neighbour to this node, for searches that run against the direction of travel.
+	virtual void get_reverse_neighbours(WareWorker type, RoutingNodeNeighbours&) = 0;
 	virtual const Coords& get_position() const = 0;
 };
 }  // namespace Widelands
@@ -70,6 +70,7 @@ public:
 	}
 
 	void get_neighbours(WareWorker type, RoutingNodeNeighbours&) override;
+	void get_reverse_neighbours(WareWorker type, RoutingNodeNeighbours&) override;
 
 	// test functionality
 	bool all_members_zeroed();
@@ -89,6 +90,13 @@ void TestingRoutingNode::get_neighbours(WareWorker type, RoutingNodeNeighbours&
 		n.push_back(RoutingNodeNeighbour(nb, 1000 * ((type == wwWARE) ? 1 + waitcost_ : 1)));
 	}
 }
+void TestingRoutingNode::get_reverse_neighbours(WareWorker type, RoutingNodeNeighbours& n) {
+	// All test nodes are connected in both directions, so the cost to get from
+	// the neighbour to this node depends on the waitcost of the neighbour.
+	for (TestingRoutingNode* nb : neighbours_) {
+		n.push_back(RoutingNodeNeighbour(nb, 1000 * ((type == wwWARE) ? 1 + nb->waitcost_ : 1)));
+	}
+}
 bool TestingRoutingNode::all_members_zeroed() {
 	bool integers_zero = !mpf_cycle && !mpf_realcost && !mpf_estimate;
 	bool pointers_zero = (mpf_backlink == nullptr);
@@ -109,8 +117,12 @@ class TestingRoute : public IRoute {
 public:
 	using Nodes = std::vector<RoutingNode*>;
 
-	void init(int32_t) override {
+	TestingRoute() : totalcost_(0) {
+	}
+
+	void init(int32_t totalcost) override {
 		nodes.clear();
+		totalcost_ = totalcost;
 	}
 	void insert_as_first(RoutingNode* node) override {
 		nodes.insert(nodes.begin(), node);
@@ -119,6 +131,9 @@ public:
 	int32_t get_length() {
 		return nodes.size();
 	}
+	int32_t get_totalcost() const {
+		return totalcost_;
+	}
 
 	bool has_node(RoutingNode* const n) {
 		for (RoutingNode* temp_node : nodes) {
@@ -164,6 +179,7 @@ public:
 
 private:
 	Nodes nodes;
+	int32_t totalcost_;
 };
 
 /// End of helper classes }}}
@@ -593,6 +609,123 @@ BOOST_FIXTURE_TEST_CASE(cutoff, DistanceRoutingFixture) {
 	BOOST_CHECK_EQUAL(rval, false);
 }
 
+/*************************************************************************/
+/*                          Multi-source routing                         */
+/*************************************************************************/
+BOOST_FIXTURE_TEST_CASE(find_route_from_any_picks_cheapest_start, DistanceRoutingFixture) {
+	std::vector<RoutingNode*> starts;
+	starts.push_back(d3);
+	starts.push_back(start);
+
+	// start -> d1 -> end is cheaper than d3 -> d4 -> d5 -> end
+	RoutingNode* best = r.find_route_from_any(starts, *end, &route, wwWORKER, -1, cc);
+	BOOST_CHECK_EQUAL(best, start);
+
+	Nodes chain;
+	chain.push_back(start);
+	chain.push_back(d1);
+	chain.push_back(end);
+	BOOST_CHECK(route.has_chain(chain));
+	BOOST_CHECK_EQUAL(route.get_length(), 3);
+
+	// Wares avoid the expensive node, so d3 wins now
+	d1->set_waitcost(8);
+	best = r.find_route_from_any(starts, *end, &route, wwWARE, -1, cc);
+	BOOST_CHECK_EQUAL(best, d3);
+
+	chain.clear();
+	chain.push_back(d3);
+	chain.push_back(d4);
+	chain.push_back(d5);
+	chain.push_back(end);
+	BOOST_CHECK(route.has_chain(chain));
+	BOOST_CHECK_EQUAL(route.get_length(), 4);
+}
+BOOST_FIXTURE_TEST_CASE(find_route_from_any_unreachable, DistanceRoutingFixture) {
+	TestingRoutingNode* island = new TestingRoutingNode(0, Coords(5, 5));
+	nodes.push_back(island);
+
+	std::vector<RoutingNode*> starts;
+	starts.push_back(island);
+	BOOST_CHECK(r.find_route_from_any(starts, *end, &route, wwWORKER, -1, cc) == nullptr);
+
+	// Adding a connected start makes the search succeed
+	starts.push_back(d2);
+	BOOST_CHECK_EQUAL(r.find_route_from_any(starts, *end, &route, wwWORKER, -1, cc), d2);
+}
+
+/*************************************************************************/
+/*                             Distance fields                           */
+/*************************************************************************/
+BOOST_FIXTURE_TEST_CASE(distance_field_matches_find_route, DistanceRoutingFixture) {
+	d1->set_waitcost(8);
+	TestingRoutingNode* island = new TestingRoutingNode(0, Coords(5, 5));
+	nodes.push_back(island);
+
+	for (WareWorker type : {wwWORKER, wwWARE}) {
+		Router::DistanceField distances;
+		r.calc_distances_to(*end, type, &distances);
+
+		for (RoutingNode* node : nodes) {
+			if (node == island) {
+				BOOST_CHECK(distances.count(node) == 0);
+				continue;
+			}
+			BOOST_CHECK(r.find_route(*node, *end, &route, type, -1, cc));
+			BOOST_CHECK(distances.count(node) == 1);
+			BOOST_CHECK_EQUAL(distances[node], route.get_totalcost());
+		}
+	}
+	Router::DistanceField distances;
+	r.calc_distances_to(*end, wwWARE, &distances);
+	BOOST_CHECK_EQUAL(distances[end], 0);
+	// start -> d2 -> d3 -> d4 -> d5 -> end is cheaper than going through d1
+	BOOST_CHECK_EQUAL(distances[start], 5000);
+	// d1 itself pays its own waitcost when leaving
+	BOOST_CHECK_EQUAL(distances[d1], 9000);
+}
+
+/*************************************************************************/
+/*                               Landmarks                               */
+/*************************************************************************/
+BOOST_FIXTURE_TEST_CASE(landmark_bounds_are_lower_bounds, DistanceRoutingFixture) {
+	d1->set_waitcost(8);
+	add_dead_end(d3);
+	add_dead_end(end);
+
+	r.calc_landmarks(nodes);
+	BOOST_CHECK(r.landmarks_valid());
+
+	for (RoutingNode* from : nodes) {
+		for (RoutingNode* to : nodes) {
+			BOOST_CHECK(r.find_route(*from, *to, &route, wwWORKER, -1, cc));
+			BOOST_CHECK(r.landmark_lower_bound(*from, *to) <= route.get_totalcost());
+		}
+	}
+	// The dead ends are far away from each other, so one of them is a landmark
+	BOOST_CHECK(r.landmark_lower_bound(*nodes.back(), *start) > 0);
+
+	r.invalidate_landmarks();
+	BOOST_CHECK(!r.landmarks_valid());
+	BOOST_CHECK_EQUAL(r.landmark_lower_bound(*nodes.back(), *start), 0);
+}
+BOOST_FIXTURE_TEST_CASE(landmarks_find_cheapest_route, DistanceRoutingFixture) {
+	d1->set_waitcost(8);
+	add_dead_end(d4);
+
+	std::vector<int32_t> costs;
+	for (RoutingNode* from : nodes) {
+		BOOST_CHECK(r.find_route(*from, *end, &route, wwWARE, -1, cc));
+		costs.push_back(route.get_totalcost());
+	}
+
+	r.calc_landmarks(nodes);
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		BOOST_CHECK(r.find_route(*nodes[i], *end, &route, wwWARE, -1, cc));
+		BOOST_CHECK_EQUAL(route.get_totalcost(), costs[i]);
+	}
+}
+
 // }}}
 
 BOOST_AUTO_TEST_SUITE_END()
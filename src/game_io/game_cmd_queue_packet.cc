@@ -19,6 +19,9 @@
 
 #include "game_io/game_cmd_queue_packet.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "base/macros.h"
 #include "io/fileread.h"
 #include "io/filewrite.h"
@@ -54,7 +57,7 @@ void GameCmdQueuePacket::read(FileSystem& fs, Game& game, MapObjectLoader* const
 					break;
 
 				CmdQueue::CmdItem item;
-				item.category = fr.signed_32();
+				item.category = static_cast<CommandCategory>(fr.signed_32());
 				item.serial = fr.unsigned_32();
 
 				GameLogicCommand& cmd = QueueCmdFactory::create_correct_queue_command(
@@ -62,8 +65,9 @@ void GameCmdQueuePacket::read(FileSystem& fs, Game& game, MapObjectLoader* const
 				cmd.read(fr, game, *ol);
 
 				item.cmd = &cmd;
+				item.duetime = cmd.duetime();
 
-				cmdq.cmds_[cmd.duetime() % kCommandQueueBucketSize].push(item);
+				cmdq.insert(item);
 				++cmdq.ncmds_;
 			}
 		} else {
@@ -88,40 +92,27 @@ void GameCmdQueuePacket::write(FileSystem& fs, Game& game, MapObjectSaver* const
 
 	// Write all commands
 
-	// Find all the items in the current cmdqueue
-	uint32_t time = game.get_gametime();
-	size_t nhandled = 0;
+	// Write the commands in the order in which they will be executed
+	std::vector<CmdQueue::CmdItem> items;
+	cmdq.collect_items(&items);
+	std::sort(items.begin(), items.end(),
+	          [](const CmdQueue::CmdItem& a, const CmdQueue::CmdItem& b) { return b < a; });
 
-	while (nhandled < cmdq.ncmds_) {
-		// Make a copy, so we can pop stuff
-		std::priority_queue<CmdQueue::CmdItem> p = cmdq.cmds_[time % kCommandQueueBucketSize];
+	for (const CmdQueue::CmdItem& it : items) {
+		if (it.category == CommandCategory::kNonGameLogic) {
+			continue;
+		}
+		GameLogicCommand* cmd = static_cast<GameLogicCommand*>(it.cmd);
 
-		while (!p.empty()) {
-			const CmdQueue::CmdItem& it = p.top();
-			if (it.cmd->duetime() > time) {
-				// Time is the primary sorting key, so we can't have any additional commands in this
-				// queue for this time
-				break;
-			}
-			if (it.cmd->duetime() == time) {
-				if (upcast(GameLogicCommand, cmd, it.cmd)) {
-					// The id (aka command type)
-					fw.unsigned_16(static_cast<uint16_t>(cmd->id()));
-
-					// Serial number
-					fw.signed_32(it.category);
-					fw.unsigned_32(it.serial);
-
-					// Now the command itself
-					cmd->write(fw, game, *os);
-				}
-				++nhandled;
-			}
+		// The id (aka command type)
+		fw.unsigned_16(static_cast<uint16_t>(cmd->id()));
 
-			// DONE: next command
-			p.pop();
-		}
-		++time;
+		// Serial number
+		fw.signed_32(static_cast<int32_t>(it.category));
+		fw.unsigned_32(it.serial);
+
+		// Now the command itself
+		cmd->write(fw, game, *os);
 	}
 
 	fw.unsigned_16(0);  // end of command queue
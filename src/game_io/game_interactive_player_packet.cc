@@ -152,8 +152,14 @@ void GameInteractivePlayerPacket::write(FileSystem& fs, Game& game, MapObjectSav
 			fw.float_32(landmark.view.zoom);
 		}
 
-		fw.unsigned_32(ibase->get_expedition_port_spaces().size());
+		std::vector<std::pair<const Widelands::Ship*, Widelands::Coords>> port_spaces;
 		for (const auto& pair : ibase->get_expedition_port_spaces()) {
+			if (const Widelands::Ship* ship = pair.first.get(game)) {
+				port_spaces.push_back(std::make_pair(ship, pair.second));
+			}
+		}
+		fw.unsigned_32(port_spaces.size());
+		for (const auto& pair : port_spaces) {
 			fw.unsigned_32(mos->get_object_file_index(*pair.first));
 			fw.signed_16(pair.second.x);
 			fw.signed_16(pair.second.y);
@@ -20,6 +20,8 @@
 #include "game_io/game_loader.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <boost/bind.hpp>
 #include <boost/signals2.hpp>
@@ -65,6 +67,15 @@ int32_t GameLoader::preload_game(GamePreloadPacket& mp) {
 int32_t GameLoader::load_game(bool const multiplayer) {
 	ScopedTimer timer("GameLoader::load() took %ums");
 
+	// The map packets are prefetched by the map loader
+	std::vector<std::string> packet_files = {"binary/game_class", "binary/player_info",
+	                                         "binary/player_economies", "binary/player_ai",
+	                                         "binary/cmd_queue"};
+	if (!multiplayer) {
+		packet_files.push_back("binary/interactive_player");
+	}
+	fs_.prefetch(packet_files);
+
 	log("Game: Reading Preload Data ... ");
 	{
 		GamePreloadPacket p;
@@ -26,6 +26,7 @@
 
 #include "base/time_string.h"
 #include "build_info.h"
+#include "graphic/graphic.h"
 #include "graphic/image_io.h"
 #include "graphic/minimap_renderer.h"
 #include "io/profile.h"
@@ -116,7 +117,7 @@ void GamePreloadPacket::write(FileSystem& fs, Game& game, MapObjectSaver* const)
 	prof.write("preload", false, fs);
 
 	// Write minimap image
-	if (!game.is_loaded()) {
+	if (!game.is_loaded() || g_gr->is_headless()) {
 		return;
 	}
 
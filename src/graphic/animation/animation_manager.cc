@@ -53,6 +53,10 @@ const Animation& AnimationManager::get_animation(uint32_t id) const {
 }
 
 const Image* AnimationManager::get_representative_image(uint32_t id, const RGBColor* clr) {
+	if (g_gr->is_headless()) {
+		// Blending the representative image needs an OpenGL context
+		return g_gr->images().placeholder();
+	}
 	const auto hash = std::make_pair(id, clr);
 	if (representative_images_.count(hash) != 1) {
 		representative_images_.insert(std::make_pair(
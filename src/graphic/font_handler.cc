@@ -19,12 +19,17 @@
 
 #include "graphic/font_handler.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <limits>
 #include <memory>
 
 #include <boost/lexical_cast.hpp>
 
+#include "base/log.h"
 #include "graphic/text/rt_render.h"
 #include "graphic/text/texture_cache.h"
+#include "wlapplication_options.h"
 
 namespace {
 
@@ -39,13 +44,22 @@ namespace {
 // generated by mousing over things. Typing 500+ characters in a Multilineeditbox did not trigger
 // texture dropping.
 
-// The size of the richtext surface cache in bytes.
-constexpr uint32_t kTextureCacheSize = 3 << 20;  // shifting by 20 converts to MB
+// The default size of the richtext surface cache in MB. Can be changed with the
+// 'text_texture_cache_mb' config option.
+constexpr uint32_t kTextureCacheSizeMB = 3;
 
 // The maximum number of RenderedRects. It's all pointers or combinations of basic data types, so
 // the size requirement is pretty constant. Therefore, simply counting them is sufficient.
 // We estimate that the member variables of each RenderedRect take up ca. 13 * 32 bytes.
 constexpr uint32_t kRenderCacheSize = 8 * 1024;
+
+// The size budget of the richtext surface cache in bytes. The cache counts in 32 bit, so
+// configured sizes of 4 GB and more are clamped.
+uint32_t texture_cache_size() {
+	const uint64_t bytes =
+	   static_cast<uint64_t>(get_config_natural("text_texture_cache_mb", kTextureCacheSizeMB)) << 20;
+	return std::min<uint64_t>(bytes, std::numeric_limits<uint32_t>::max());
+}
 }  // namespace
 
 namespace UI {
@@ -70,7 +84,7 @@ private:
 
 public:
 	FontHandler(ImageCache* image_cache, const std::string& locale)
-	   : texture_cache_(new TextureCache(kTextureCacheSize)),
+	   : texture_cache_(new TextureCache(texture_cache_size())),
 	     render_cache_(new RenderCache(kRenderCacheSize)),
 	     fontsets_(),
 	     fontset_(fontsets_.get_fontset(locale)),
@@ -78,6 +92,8 @@ public:
 	     image_cache_(image_cache) {
 	}
 	~FontHandler() override {
+		log_statistics("Texture cache", *texture_cache_);
+		log_statistics("Render cache", *render_cache_);
 	}
 
 	// This will render the 'text' with a width restriction of 'w'. If 'w' == 0, no restriction is
@@ -105,6 +121,14 @@ public:
 	}
 
 private:
+	template <typename T>
+	static void log_statistics(const char* name, const TransientCache<T>& cache) {
+		const typename TransientCache<T>::Statistics& statistics = cache.statistics();
+		log("%s: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " evictions, %u/%u used\n", name,
+		    statistics.hits, statistics.misses, statistics.evictions, cache.size(),
+		    cache.max_size());
+	}
+
 	std::unique_ptr<TextureCache> texture_cache_;
 	std::unique_ptr<RenderCache> render_cache_;
 	UI::FontSets fontsets_;       // All fontsets
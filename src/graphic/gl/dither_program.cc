@@ -106,7 +106,11 @@ void DitherProgram::maybe_add_dithering_triangle(
 	}
 }
 
-void DitherProgram::gl_draw(int gl_texture, float texture_w, float texture_h, const float z_value) {
+void DitherProgram::gl_draw(int gl_texture,
+                            float texture_w,
+                            float texture_h,
+                            const float z_value,
+                            const bool view_unchanged) {
 	glUseProgram(gl_program_.object());
 
 	auto& gl_state = Gl::State::instance();
@@ -115,7 +119,11 @@ void DitherProgram::gl_draw(int gl_texture, float texture_w, float texture_h, co
 	                                     attr_texture_position_});
 
 	gl_array_buffer_.bind();
-	gl_array_buffer_.update(vertices_);
+	if (view_unchanged) {
+		gl_array_buffer_.update_if_changed(vertices_, last_vertices_);
+	} else {
+		gl_array_buffer_.update(vertices_);
+	}
 
 	Gl::vertex_attrib_pointer(
 	   attr_brightness_, 1, sizeof(PerVertexData), offsetof(PerVertexData, brightness));
@@ -148,6 +156,7 @@ void DitherProgram::draw(
 	// all are packed into the same texture atlas, i.e. all are in the same GL
 	// texture. It does not check for this invariance for speeds sake.
 
+	vertices_.swap(last_vertices_);
 	vertices_.clear();
 	vertices_.reserve(fields_to_draw.size() * 3);
 
@@ -201,5 +210,6 @@ void DitherProgram::draw(
 
 	const BlitData& blit_data = terrains.get(0).get_texture(0).blit_data();
 	const Rectf texture_coordinates = to_gl_texture(blit_data);
-	gl_draw(blit_data.texture_id, texture_coordinates.w, texture_coordinates.h, z_value);
+	gl_draw(blit_data.texture_id, texture_coordinates.w, texture_coordinates.h, z_value,
+	        fields_to_draw.view_unchanged());
 }
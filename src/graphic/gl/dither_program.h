@@ -79,9 +79,11 @@ private:
 		float texture_offset_x;
 		float texture_offset_y;
 	};
+	static_assert(sizeof(PerVertexData) == 36, "Wrong padding.");
 
-	// Call through to GL.
-	void gl_draw(int gl_texture, float texture_w, float texture_h, float z_value);
+	// Call through to GL. Only compares the vertices with the last frame's if 'view_unchanged'.
+	void gl_draw(
+	   int gl_texture, float texture_w, float texture_h, float z_value, bool view_unchanged);
 
 	// The program used for drawing the terrain.
 	Gl::Program gl_program_;
@@ -108,6 +110,9 @@ private:
 	// Objects below are here to avoid memory allocations on each frame, they
 	// could theoretically also always be recreated.
 	std::vector<PerVertexData> vertices_;
+
+	// The vertices of the last frame, which the buffer still contains.
+	std::vector<PerVertexData> last_vertices_;
 };
 
 #endif  // end of include guard: WL_GRAPHIC_GL_DITHER_PROGRAM_H
@@ -67,17 +67,86 @@ float field_brightness(const Widelands::FCoords& fcoords) {
 
 }  // namespace
 
+void FieldsToDraw::init_field(const Widelands::Map& map, int fx, int fy, Field* f) const {
+	f->geometric_coords = Widelands::Coords(fx, fy);
+
+	f->ln_index = calculate_index(fx - 1, fy);
+	f->rn_index = calculate_index(fx + 1, fy);
+	f->trn_index = calculate_index(fx + (fy & 1), fy - 1);
+	f->bln_index = calculate_index(fx + (fy & 1) - 1, fy + 1);
+	f->brn_index = calculate_index(fx + (fy & 1), fy + 1);
+
+	// Texture coordinates for pseudo random tiling of terrain and road
+	// graphics. Since screen space X increases top-to-bottom and OpenGL
+	// increases bottom-to-top we flip the y coordinate to not have
+	// terrains and road graphics vertically mirrorerd.
+	const Vector2f map_pixel =
+	   MapviewPixelFunctions::to_map_pixel_ignoring_height(f->geometric_coords);
+	f->texture_coords.x = map_pixel.x / Widelands::kTextureSideLength;
+	f->texture_coords.y = -map_pixel.y / Widelands::kTextureSideLength;
+
+	Widelands::Coords normalized = f->geometric_coords;
+	map.normalize_coords(normalized);
+	f->fcoords = map.get_fcoords(normalized);
+}
+
+void FieldsToDraw::scroll_to(const Widelands::Map& map, int const min_fx, int const min_fy) {
+	const int old_min_fx = min_fx_;
+	const int old_min_fy = min_fy_;
+	const int old_max_fx = max_fx_;
+	const int old_max_fy = max_fy_;
+
+	min_fx_ = min_fx;
+	min_fy_ = min_fy;
+	max_fx_ = min_fx_ + w_ - 1;
+	max_fy_ = min_fy_ + h_ - 1;
+
+	fields_.swap(previous_fields_);
+	fields_.resize(previous_fields_.size());
+
+	for (int32_t fy = min_fy_; fy <= max_fy_; ++fy) {
+		const bool row_was_contained = old_min_fy <= fy && fy <= old_max_fy;
+		for (int32_t fx = min_fx_; fx <= max_fx_; ++fx) {
+			FieldsToDraw::Field& f = fields_[calculate_index(fx, fy)];
+			if (!row_was_contained || fx < old_min_fx || fx > old_max_fx) {
+				init_field(map, fx, fy, &f);
+				continue;
+			}
+
+			// Only the neighbors depend on where the field is in 'fields_'.
+			f = previous_fields_[(fy - old_min_fy) * w_ + (fx - old_min_fx)];
+			f.ln_index = calculate_index(fx - 1, fy);
+			f.rn_index = calculate_index(fx + 1, fy);
+			f.trn_index = calculate_index(fx + (fy & 1), fy - 1);
+			f.bln_index = calculate_index(fx + (fy & 1) - 1, fy + 1);
+			f.brn_index = calculate_index(fx + (fy & 1), fy + 1);
+		}
+	}
+}
+
 void FieldsToDraw::reset(const Widelands::EditorGameBase& egbase,
                          const Vector2f& viewpoint,
                          const float zoom,
                          RenderTarget* dst) {
+	const auto& surface = dst->get_surface();
+	reset(egbase, viewpoint, zoom, dst->get_rect(), dst->get_offset(), surface.width(),
+	      surface.height());
+}
+
+void FieldsToDraw::reset(const Widelands::EditorGameBase& egbase,
+                         const Vector2f& viewpoint,
+                         const float zoom,
+                         const Recti& rect,
+                         const Vector2i& offset,
+                         const int surface_width,
+                         const int surface_height) {
 	assert(viewpoint.x >= 0);  // divisions involving negative numbers are bad
 	assert(viewpoint.y >= 0);
-	assert(dst->get_offset().x <= 0);
-	assert(dst->get_offset().y <= 0);
+	assert(offset.x <= 0);
+	assert(offset.y <= 0);
 
-	min_fx_ = std::floor(viewpoint.x / kTriangleWidth);
-	min_fy_ = std::floor(viewpoint.y / kTriangleHeight);
+	int min_fx = std::floor(viewpoint.x / kTriangleWidth);
+	int min_fy = std::floor(viewpoint.y / kTriangleHeight);
 
 	// If a view window is partially moved outside of the display, its 'rect' is
 	// adjusted to be fully contained on the screen - i.e. x = 0 and width is
@@ -86,83 +155,92 @@ void FieldsToDraw::reset(const Widelands::EditorGameBase& egbase,
 	// value of 'offset' to the actual dimension of the 'rect' to get to desired
 	// dimension of the 'rect'
 	const Vector2f br_map = MapviewPixelFunctions::panel_to_map(
-	   viewpoint, zoom,
-	   Vector2f(dst->get_rect().w + std::abs(dst->get_offset().x),
-	            dst->get_rect().h + std::abs(dst->get_offset().y)));
-	max_fx_ = std::ceil(br_map.x / kTriangleWidth);
-	max_fy_ = std::ceil(br_map.y / kTriangleHeight);
+	   viewpoint, zoom, Vector2f(rect.w + std::abs(offset.x), rect.h + std::abs(offset.y)));
+	int max_fx = std::ceil(br_map.x / kTriangleWidth);
+	int max_fy = std::ceil(br_map.y / kTriangleHeight);
 
 	// Adjust for triangle boundary effects and for height differences.
-	min_fx_ -= 2;
-	max_fx_ += 2;
-	min_fy_ -= 2;
-	max_fy_ += 10;
-
-	const auto& surface = dst->get_surface();
-	const int surface_width = surface.width();
-	const int surface_height = surface.height();
+	min_fx -= 2;
+	max_fx += 2;
+	min_fy -= 2;
+	max_fy += 10;
 
 	const Widelands::Map& map = egbase.map();
 
-	w_ = max_fx_ - min_fx_ + 1;
-	h_ = max_fy_ - min_fy_ + 1;
-	assert(w_ > 0);
-	assert(h_ > 0);
-
-	// Ensure that there is enough memory for the resize operation
-	size_t dimension = w_ * h_;
-	const size_t max_dimension = fields_.max_size();
-	if (dimension > max_dimension) {
-		log("WARNING: Not enough memory allocated to redraw the whole map!\nWe recommend that you "
-		    "restart Widelands\n");
-		dimension = max_dimension;
-	}
-	// Now resize the vector
-	if (fields_.size() != dimension) {
-		fields_.resize(dimension);
-	}
-
-	for (int32_t fy = min_fy_; fy <= max_fy_; ++fy) {
-		for (int32_t fx = min_fx_; fx <= max_fx_; ++fx) {
-			FieldsToDraw::Field& f = fields_[calculate_index(fx, fy)];
+	const bool same_map = cache_enabled_ && first_field_ == &map[0] &&
+	                      map_width_ == map.get_width() && map_height_ == map.get_height();
+	const bool same_view = same_map && viewpoint == viewpoint_ && zoom == zoom_ &&
+	                       rect == rect_ && offset == offset_ &&
+	                       surface_width == surface_width_ && surface_height == surface_height_;
 
-			f.geometric_coords = Widelands::Coords(fx, fy);
+	if (same_map && max_fx - min_fx + 1 == w_ && max_fy - min_fy + 1 == h_) {
+		if (min_fx != min_fx_ || min_fy != min_fy_) {
+			scroll_to(map, min_fx, min_fy);
+		}
+	} else {
+		min_fx_ = min_fx;
+		max_fx_ = max_fx;
+		min_fy_ = min_fy;
+		max_fy_ = max_fy;
+
+		w_ = max_fx_ - min_fx_ + 1;
+		h_ = max_fy_ - min_fy_ + 1;
+		assert(w_ > 0);
+		assert(h_ > 0);
+
+		// Ensure that there is enough memory for the resize operation
+		size_t dimension = w_ * h_;
+		const size_t max_dimension = fields_.max_size();
+		if (dimension > max_dimension) {
+			log("WARNING: Not enough memory allocated to redraw the whole map!\nWe recommend that "
+			    "you restart Widelands\n");
+			dimension = max_dimension;
+		}
+		// Now resize the vector
+		if (fields_.size() != dimension) {
+			fields_.resize(dimension);
+		}
 
-			f.ln_index = calculate_index(fx - 1, fy);
-			f.rn_index = calculate_index(fx + 1, fy);
-			f.trn_index = calculate_index(fx + (fy & 1), fy - 1);
-			f.bln_index = calculate_index(fx + (fy & 1) - 1, fy + 1);
-			f.brn_index = calculate_index(fx + (fy & 1), fy + 1);
+		for (int32_t fy = min_fy_; fy <= max_fy_; ++fy) {
+			for (int32_t fx = min_fx_; fx <= max_fx_; ++fx) {
+				init_field(map, fx, fy, &fields_[calculate_index(fx, fy)]);
+			}
+		}
+	}
 
-			// Texture coordinates for pseudo random tiling of terrain and road
-			// graphics. Since screen space X increases top-to-bottom and OpenGL
-			// increases bottom-to-top we flip the y coordinate to not have
-			// terrains and road graphics vertically mirrorerd.
+	view_unchanged_ = same_view;
+	first_field_ = &map[0];
+	map_width_ = map.get_width();
+	map_height_ = map.get_height();
+	viewpoint_ = viewpoint;
+	zoom_ = zoom;
+	rect_ = rect;
+	offset_ = offset;
+	surface_width_ = surface_width;
+	surface_height_ = surface_height;
+
+	for (FieldsToDraw::Field& f : fields_) {
+		const Widelands::Field::Height height = f.fcoords.field->get_height();
+		if (!same_view || f.height != height) {
+			f.height = height;
 			Vector2f map_pixel =
 			   MapviewPixelFunctions::to_map_pixel_ignoring_height(f.geometric_coords);
-			f.texture_coords.x = map_pixel.x / Widelands::kTextureSideLength;
-			f.texture_coords.y = -map_pixel.y / Widelands::kTextureSideLength;
-
-			Widelands::Coords normalized = f.geometric_coords;
-			map.normalize_coords(normalized);
-			f.fcoords = map.get_fcoords(normalized);
-
-			map_pixel.y -= f.fcoords.field->get_height() * kHeightFactor;
+			map_pixel.y -= height * kHeightFactor;
 
 			f.rendertarget_pixel = MapviewPixelFunctions::map_to_panel(viewpoint, zoom, map_pixel);
-			f.gl_position = f.surface_pixel = f.rendertarget_pixel +
-			                                  dst->get_rect().origin().cast<float>() +
-			                                  dst->get_offset().cast<float>();
+			f.gl_position = f.surface_pixel = f.rendertarget_pixel + rect.origin().cast<float>() +
+			                                  offset.cast<float>();
 			pixel_to_gl_renderbuffer(
 			   surface_width, surface_height, &f.gl_position.x, &f.gl_position.y);
+		}
 
-			f.brightness = field_brightness(f.fcoords);
+		// The callers overwrite these with what the player sees, so they always need a refresh.
+		f.brightness = field_brightness(f.fcoords);
 
-			const Widelands::PlayerNumber owned_by = f.fcoords.field->get_owned_by();
-			f.owner = owned_by != 0 ? egbase.get_player(owned_by) : nullptr;
-			f.is_border = f.fcoords.field->is_border();
-			f.vision = 2;
-			f.roads = f.fcoords.field->get_roads();
-		}
+		const Widelands::PlayerNumber owned_by = f.fcoords.field->get_owned_by();
+		f.owner = owned_by != 0 ? egbase.get_player(owned_by) : nullptr;
+		f.is_border = f.fcoords.field->is_border();
+		f.vision = 2;
+		f.roads = f.fcoords.field->get_roads();
 	}
 }
@@ -27,9 +27,11 @@
 
 #include <stdint.h>
 
+#include "base/rect.h"
 #include "base/vector.h"
 #include "graphic/rendertarget.h"
 #include "logic/editor_game_base.h"
+#include "logic/field.h"
 #include "logic/widelands_geometry.h"
 
 // Helper struct that contains the data needed for drawing all fields.
@@ -52,6 +54,9 @@ public:
 		Vector2f texture_coords = Vector2f::zero();  // Texture coordinates.
 		float brightness;                            // brightness of the pixel
 
+		// The height of the field that the positions above were calculated for.
+		Widelands::Field::Height height;
+
 		// The next values are not necessarily the true data of this field, but
 		// what the player should see. For example in fog of war we always draw
 		// what we saw last.
@@ -75,12 +80,38 @@ public:
 		}
 	};
 
-	// Reinitialize for the given view parameters.
+	// Reinitialize for the given view parameters. Fields that were already
+	// contained in the last call keep their coordinates, and their positions if
+	// the view did not change. The state of all fields is refreshed.
 	void reset(const Widelands::EditorGameBase& egbase,
 	           const Vector2f& viewpoint,
 	           const float zoom,
 	           RenderTarget* dst);
 
+	// Same as above for a render target with the given 'rect' and 'offset' on a
+	// surface of 'surface_width' x 'surface_height' pixels. Does not need a GPU.
+	void reset(const Widelands::EditorGameBase& egbase,
+	           const Vector2f& viewpoint,
+	           float zoom,
+	           const Recti& rect,
+	           const Vector2i& offset,
+	           int surface_width,
+	           int surface_height);
+
+	// If disabled, every call to reset() recalculates all fields from scratch.
+	// Enabled by default.
+	void set_cache_enabled(bool enabled) {
+		cache_enabled_ = enabled;
+		first_field_ = nullptr;
+	}
+
+	// Whether the last reset() was for the same map and view as the one
+	// before. Only the state of the fields may have changed then, so vertex
+	// data calculated from them is likely the same as in the last frame.
+	bool view_unchanged() const {
+		return view_unchanged_;
+	}
+
 	// The number of fields to draw.
 	inline size_t size() const {
 		return fields_.size();
@@ -107,6 +138,14 @@ public:
 	}
 
 private:
+	// Calculates the coordinates and neighbors of the field at the geometric
+	// coordinates ('fx', 'fy').
+	void init_field(const Widelands::Map& map, int fx, int fy, Field* f) const;
+
+	// Moves the fields that stay visible to their slots for the new minimum
+	// coordinates and initializes the ones that were not contained before.
+	void scroll_to(const Widelands::Map& map, int min_fx, int min_fy);
+
 	// Minimum and maximum field coordinates (geometric) to render. Can be negative.
 	int min_fx_ = 0;
 	int max_fx_ = 0;
@@ -118,6 +157,23 @@ private:
 	int h_ = 0;
 
 	std::vector<Field> fields_;
+
+	// The map and view parameters that 'fields_' were calculated for.
+	// 'first_field_' is nullptr if all fields need to be recalculated.
+	const Widelands::Field* first_field_ = nullptr;
+	int16_t map_width_ = 0;
+	int16_t map_height_ = 0;
+	Vector2f viewpoint_ = Vector2f::zero();
+	float zoom_ = 0.f;
+	Recti rect_;
+	Vector2i offset_ = Vector2i::zero();
+	int surface_width_ = 0;
+	int surface_height_ = 0;
+	bool cache_enabled_ = true;
+	bool view_unchanged_ = false;
+
+	// Kept around to avoid memory allocations when scrolling.
+	std::vector<Field> previous_fields_;
 };
 
 #endif  // end of include guard: WL_GRAPHIC_GL_FIELDS_TO_DRAW_H
@@ -146,6 +146,7 @@ void RoadProgram::draw(const int renderbuffer_width,
                        const FieldsToDraw& fields_to_draw,
                        const float scale,
                        const float z_value) {
+	vertices_.swap(last_vertices_);
 	vertices_.clear();
 
 	uint32_t gl_texture = 0;
@@ -189,7 +190,11 @@ void RoadProgram::draw(const int renderbuffer_width,
 	gl_state.enable_vertex_attrib_array({attr_position_, attr_texture_position_, attr_brightness_});
 
 	gl_array_buffer_.bind();
-	gl_array_buffer_.update(vertices_);
+	if (fields_to_draw.view_unchanged()) {
+		gl_array_buffer_.update_if_changed(vertices_, last_vertices_);
+	} else {
+		gl_array_buffer_.update(vertices_);
+	}
 
 	Gl::vertex_attrib_pointer(
 	   attr_position_, 2, sizeof(PerVertexData), offsetof(PerVertexData, gl_x));
@@ -85,6 +85,9 @@ private:
 	// All vertices that get rendered this frame.
 	std::vector<PerVertexData> vertices_;
 
+	// The vertices of the last frame, which the buffer still contains.
+	std::vector<PerVertexData> last_vertices_;
+
 	DISALLOW_COPY_AND_ASSIGN(RoadProgram);
 };
 
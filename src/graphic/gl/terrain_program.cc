@@ -42,7 +42,8 @@ TerrainProgram::TerrainProgram() {
 	u_z_value_ = glGetUniformLocation(gl_program_.object(), "u_z_value");
 }
 
-void TerrainProgram::gl_draw(int gl_texture, float texture_w, float texture_h, float z_value) {
+void TerrainProgram::gl_draw(
+   int gl_texture, float texture_w, float texture_h, float z_value, bool view_unchanged) {
 	glUseProgram(gl_program_.object());
 
 	auto& gl_state = Gl::State::instance();
@@ -50,7 +51,12 @@ void TerrainProgram::gl_draw(int gl_texture, float texture_w, float texture_h, f
 	   {attr_brightness_, attr_position_, attr_texture_offset_, attr_texture_position_});
 
 	gl_array_buffer_.bind();
-	gl_array_buffer_.update(vertices_);
+	// While scrolling, all positions change anyway, so comparing would only cost time
+	if (view_unchanged) {
+		gl_array_buffer_.update_if_changed(vertices_, last_vertices_);
+	} else {
+		gl_array_buffer_.update(vertices_);
+	}
 
 	Gl::vertex_attrib_pointer(
 	   attr_brightness_, 1, sizeof(PerVertexData), offsetof(PerVertexData, brightness));
@@ -92,6 +98,7 @@ void TerrainProgram::draw(
 	// all are packed into the same texture atlas, i.e. all are in the same GL
 	// texture. It does not check for this invariance for speeds sake.
 
+	vertices_.swap(last_vertices_);
 	vertices_.clear();
 	vertices_.reserve(fields_to_draw.size() * 3);
 
@@ -130,5 +137,6 @@ void TerrainProgram::draw(
 
 	const BlitData& blit_data = terrains.get(0).get_texture(0).blit_data();
 	const Rectf texture_coordinates = to_gl_texture(blit_data);
-	gl_draw(blit_data.texture_id, texture_coordinates.w, texture_coordinates.h, z_value);
+	gl_draw(blit_data.texture_id, texture_coordinates.w, texture_coordinates.h, z_value,
+	        fields_to_draw.view_unchanged());
 }
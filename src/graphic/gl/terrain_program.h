@@ -51,7 +51,9 @@ private:
 	};
 	static_assert(sizeof(PerVertexData) == 28, "Wrong padding.");
 
-	void gl_draw(int gl_texture, float texture_w, float texture_h, float z_value);
+	// Only compares the vertices with the last frame's if 'view_unchanged'.
+	void gl_draw(
+	   int gl_texture, float texture_w, float texture_h, float z_value, bool view_unchanged);
 
 	// Adds a vertex to the end of vertices with data from 'field' and 'texture_coordinates'.
 	void add_vertex(const FieldsToDraw::Field& field, const Vector2f& texture_coordinates);
@@ -77,6 +79,10 @@ private:
 	// They could theoretically also be recreated.
 	std::vector<PerVertexData> vertices_;
 
+	// The vertices of the last frame, which the buffer still contains. Swapped
+	// with 'vertices_' on each frame, so that they can be compared without a copy.
+	std::vector<PerVertexData> last_vertices_;
+
 	DISALLOW_COPY_AND_ASSIGN(TerrainProgram);
 };
 
@@ -19,6 +19,7 @@
 #ifndef WL_GRAPHIC_GL_UTILS_H
 #define WL_GRAPHIC_GL_UTILS_H
 
+#include <cstring>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -93,6 +94,20 @@ public:
 		glBufferData(GL_ARRAY_BUFFER, items.size() * sizeof(T), items.data(), GL_DYNAMIC_DRAW);
 	}
 
+	// Like update(), but skips the upload if 'items' are the same as
+	// 'previous', which must be what the buffer was last filled with. The caller
+	// keeps 'previous' so that no copy of the data is needed, and should only
+	// call this when the data is likely unchanged, e.g. while the map view does
+	// not move. 'T' must not contain padding.
+	void update_if_changed(const std::vector<T>& items, const std::vector<T>& previous) {
+		if (items.size() == previous.size() &&
+		    (items.empty() ||
+		     std::memcmp(items.data(), previous.data(), items.size() * sizeof(T)) == 0)) {
+			return;
+		}
+		update(items);
+	}
+
 private:
 	GLuint object_;
 
@@ -135,6 +135,13 @@ void Graphic::initialize(const TraceGl& trace_gl,
 	styles().init();
 }
 
+void Graphic::initialize_headless() {
+	headless_ = true;
+	image_cache_->use_placeholders();
+	// The game logic uses the styles for its statistics strings
+	styles().init();
+}
+
 Graphic::~Graphic() {
 	if (sdl_window_) {
 		SDL_DestroyWindow(sdl_window_);
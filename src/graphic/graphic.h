@@ -66,6 +66,16 @@ public:
 	void
 	initialize(const TraceGl& trace_gl, int window_mode_w, int window_mode_height, bool fullscreen);
 
+	// Initializes without a window and OpenGL context, for running the game
+	// logic without display. Nothing can be drawn then: images are not loaded,
+	// the image cache hands out empty placeholders instead.
+	void initialize_headless();
+
+	// Whether this was initialized by initialize_headless().
+	bool is_headless() const {
+		return headless_;
+	}
+
 	// Gets and sets the resolution.
 	void change_resolution(int w, int h);
 	int get_xres();
@@ -112,7 +122,10 @@ private:
 	/// opengl rendering as the SurfaceOpenGL does not use it. It allows
 	/// manipulation the screen context.
 	SDL_Window* sdl_window_ = nullptr;
-	SDL_GLContext gl_context_;
+	SDL_GLContext gl_context_ = nullptr;
+
+	/// Whether we run without window and OpenGL context.
+	bool headless_ = false;
 
 	/// The maximum width or height a texture can have.
 	int max_texture_size_ = kMinimumSizeForTextures;
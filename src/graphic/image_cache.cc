@@ -30,6 +30,30 @@
 #include "graphic/image_io.h"
 #include "graphic/texture.h"
 
+namespace {
+
+// An image without pixels that is never backed by an OpenGL texture.
+class PlaceholderImage : public Image {
+public:
+	PlaceholderImage() : blit_data_{0, 0, 0, Rectf()} {
+	}
+
+	int width() const override {
+		return 0;
+	}
+	int height() const override {
+		return 0;
+	}
+	const BlitData& blit_data() const override {
+		return blit_data_;
+	}
+
+private:
+	const BlitData blit_data_;
+};
+
+}  // namespace
+
 ImageCache::ImageCache() {
 }
 
@@ -40,6 +64,10 @@ bool ImageCache::has(const std::string& hash) const {
 	return images_.count(hash);
 }
 
+void ImageCache::use_placeholders() {
+	placeholder_.reset(new PlaceholderImage());
+}
+
 const Image* ImageCache::insert(const std::string& hash, std::unique_ptr<const Image> image) {
 	assert(!has(hash));
 	const Image* return_value = image.get();
@@ -58,11 +86,15 @@ void ImageCache::fill_with_texture_atlases(
 
 /** Lazy accees to _images via hash.
  *
- * In case hash is not not found it will we fetched via load_image().
+ * In case hash is not not found it will we fetched via load_image(), or the
+ * placeholder is returned if use_placeholders() has been called.
  */
 const Image* ImageCache::get(const std::string& hash) {
 	auto it = images_.find(hash);
 	if (it == images_.end()) {
+		if (placeholder_ != nullptr) {
+			return placeholder_.get();
+		}
 		return images_.insert(std::make_pair(hash, load_image(hash))).first->second.get();
 	}
 	return it->second.get();
@@ -54,6 +54,17 @@ public:
 	// Returns true if the 'hash' is stored in the cache.
 	bool has(const std::string& hash) const;
 
+	// From now on, 'get' does not load unknown images from disk anymore, but
+	// returns an empty placeholder image for them. Used when there is no
+	// display to render to.
+	void use_placeholders();
+
+	// The empty image returned for unknown hashes after use_placeholders()
+	// has been called, nullptr before.
+	const Image* placeholder() const {
+		return placeholder_.get();
+	}
+
 	// Fills the image cache with the hash -> Texture map 'textures_in_atlas'
 	// and take ownership of 'texture_atlases' so that the textures stay valid.
 	void
@@ -63,6 +74,7 @@ public:
 private:
 	std::vector<std::unique_ptr<Texture>> texture_atlases_;
 	std::map<std::string, std::unique_ptr<const Image>> images_;
+	std::unique_ptr<const Image> placeholder_;
 
 	DISALLOW_COPY_AND_ASSIGN(ImageCache);
 };
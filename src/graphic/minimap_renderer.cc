@@ -19,12 +19,14 @@
 
 #include "graphic/minimap_renderer.h"
 
+#include <cstring>
 #include <memory>
 
 #include "base/macros.h"
 #include "economy/flag.h"
 #include "economy/road.h"
 #include "logic/field.h"
+#include "logic/game.h"
 #include "logic/map_objects/world/terrain_description.h"
 #include "logic/map_objects/world/world.h"
 #include "wui/mapviewpixelconstants.h"
@@ -85,21 +87,65 @@ inline RGBColor calc_minimap_color(const Widelands::EditorGameBase& egbase,
 	return color;
 }
 
+// Returns the color of the field 'f' as 'player' knows it. Fields that the
+// player has never seen are black.
+RGBColor calc_field_color(const Widelands::EditorGameBase& egbase,
+                          const Widelands::Player* player,
+                          const Widelands::FCoords& f,
+                          Widelands::MapIndex i,
+                          MiniMapLayer layers) {
+	uint16_t vision = 0;  // See Player::Field::Vision: 1 if seen once, > 1 if seen right now.
+	Widelands::PlayerNumber owner = 0;
+	if (player == nullptr || player->see_all()) {
+		// This player has omnivision - show the field like it is in reality.
+		vision = 2;  // Seen right now.
+		owner = f.field->get_owned_by();
+	} else if (player != nullptr) {
+		// This player might be affected by fog of war - instead of the
+		// reality, we show her what she last saw on this field. If she has
+		// vision of this field, this will be the same as reality -
+		// otherwise this shows reality as it was the last time she had
+		// vision on the field.
+		// If she never had vision, field.vision will be 0.
+		const auto& field = player->fields()[i];
+		vision = field.vision;
+		owner = field.owner;
+	}
+
+	if (vision == 0) {
+		return RGBColor(0, 0, 0);
+	}
+	return calc_minimap_color(egbase, f, layers, owner, vision > 1);
+}
+
+// Packs 'color' into the memory layout expected by Texture::set_pixels().
+uint32_t pack_color(const RGBColor& color) {
+	const uint8_t bytes[4] = {color.r, color.g, color.b, 255};
+	uint32_t packed;
+	memcpy(&packed, bytes, sizeof(packed));
+	return packed;
+}
+
+// Calls 'set_red(x, y)' for every minimap pixel of the dotted view window frame.
+template <typename SetRed>
 void draw_view_window(const Map& map,
                       const Rectf& view_area,
                       const MiniMapType minimap_type,
                       const bool zoom,
-                      Texture* texture) {
+                      SetRed set_red) {
 	const float divider = zoom ? 1.f : 2.f;
 	const int half_width =
 	   round_up_to_nearest_even(std::ceil(view_area.w / kTriangleWidth / divider));
 	const int half_height =
 	   round_up_to_nearest_even(std::ceil(view_area.h / kTriangleHeight / divider));
 
+	const int width = zoom ? map.get_width() * 2 : map.get_width();
+	const int height = zoom ? map.get_height() * 2 : map.get_height();
+
 	Vector2i center_pixel = Vector2i::zero();
 	switch (minimap_type) {
 	case MiniMapType::kStaticViewWindow:
-		center_pixel = Vector2i(texture->width() / 2, texture->height() / 2);
+		center_pixel = Vector2i(width / 2, height / 2);
 		break;
 
 	case MiniMapType::kStaticMap: {
@@ -111,9 +157,7 @@ void draw_view_window(const Map& map,
 	}
 	}
 
-	const int width = zoom ? map.get_width() * 2 : map.get_width();
-	const int height = zoom ? map.get_height() * 2 : map.get_height();
-	const auto make_red = [width, height, &texture](int x, int y) {
+	const auto make_red = [width, height, &set_red](int x, int y) {
 		if (x < 0) {
 			x += width;
 		}
@@ -126,7 +170,7 @@ void draw_view_window(const Map& map,
 		if (y >= height) {
 			y -= height;
 		}
-		texture->set_pixel(x, y, kRed);
+		set_red(x, y);
 	};
 
 	bool draw = true;
@@ -148,6 +192,17 @@ void draw_view_window(const Map& map,
 	}
 }
 
+// Returns the node that is drawn in the top-left corner of the minimap.
+Coords minimap_top_left_node(const Map& map,
+                             const Rectf& view_area,
+                             MiniMapType minimap_type,
+                             bool zoom) {
+	// Center the view on the middle of the 'view_area'.
+	Vector2f top_left =
+	   minimap_pixel_to_mappixel(map, Vector2i::zero(), view_area, minimap_type, zoom);
+	return MapviewPixelFunctions::calc_node_and_triangle(map, top_left.x, top_left.y).node;
+}
+
 // Does the actual work of drawing the minimap.
 void do_draw_minimap(Texture* texture,
                      const Widelands::EditorGameBase& egbase,
@@ -170,27 +225,7 @@ void do_draw_minimap(Texture* texture,
 				move_r(mapwidth, f, i);
 			}
 
-			uint16_t vision = 0;  // See Player::Field::Vision: 1 if seen once, > 1 if seen right now.
-			Widelands::PlayerNumber owner = 0;
-			if (player == nullptr || player->see_all()) {
-				// This player has omnivision - show the field like it is in reality.
-				vision = 2;  // Seen right now.
-				owner = f.field->get_owned_by();
-			} else if (player != nullptr) {
-				// This player might be affected by fog of war - instead of the
-				// reality, we show her what she last saw on this field. If she has
-				// vision of this field, this will be the same as reality -
-				// otherwise this shows reality as it was the last time she had
-				// vision on the field.
-				// If she never had vision, field.vision will be 0.
-				const auto& field = player->fields()[i];
-				vision = field.vision;
-				owner = field.owner;
-			}
-
-			if (vision > 0) {
-				texture->set_pixel(x, y, calc_minimap_color(egbase, f, layers, owner, vision > 1));
-			}
+			texture->set_pixel(x, y, calc_field_color(egbase, player, f, i, layers));
 		}
 	}
 }
@@ -227,9 +262,7 @@ std::unique_ptr<Texture> draw_minimap(const EditorGameBase& egbase,
                                       const Rectf& view_area,
                                       const MiniMapType& minimap_type,
                                       MiniMapLayer layers) {
-	// TODO(sirver): Currently the minimap is redrawn every frame. That is not really
-	//       necessary. The created texture could be cached and only redrawn two
-	//       or three times per second
+	// The minimap window uses MiniMapCache instead, this is for one-off renderings.
 	const Map& map = egbase.map();
 	const int16_t map_w = (layers & MiniMapLayer::Zoom2) ? map.get_width() * 2 : map.get_width();
 	const int16_t map_h = (layers & MiniMapLayer::Zoom2) ? map.get_height() * 2 : map.get_height();
@@ -239,20 +272,170 @@ std::unique_ptr<Texture> draw_minimap(const EditorGameBase& egbase,
 	texture->fill_rect(
 	   Rectf(0.f, 0.f, texture->width(), texture->height()), RGBAColor(0, 0, 0, 255));
 
-	// Center the view on the middle of the 'view_area'.
 	const bool zoom = layers & MiniMapLayer::Zoom2;
-	Vector2f top_left =
-	   minimap_pixel_to_mappixel(map, Vector2i::zero(), view_area, minimap_type, zoom);
-	const Coords node =
-	   MapviewPixelFunctions::calc_node_and_triangle(map, top_left.x, top_left.y).node;
+	const Coords node = minimap_top_left_node(map, view_area, minimap_type, zoom);
 
 	texture->lock();
 	do_draw_minimap(texture.get(), egbase, player, Vector2i(node.x, node.y), layers);
 
 	if (layers & MiniMapLayer::ViewWindow) {
-		draw_view_window(map, view_area, minimap_type, zoom, texture.get());
+		Texture* const target = texture.get();
+		draw_view_window(map, view_area, minimap_type, zoom,
+		                 [target](int x, int y) { target->set_pixel(x, y, kRed); });
 	}
 	texture->unlock(Texture::Unlock_Update);
 
 	return texture;
 }
+
+MiniMapCache::MiniMapCache(const EditorGameBase& egbase)
+   : egbase_(egbase),
+     player_number_(0),
+     see_all_(false),
+     color_layers_(MiniMapLayer::Terrain),
+     colors_changed_(true),
+     minimap_type_(MiniMapType::kStaticViewWindow),
+     texture_layers_(MiniMapLayer::Terrain),
+     field_possession_subscriber_(Notifications::subscribe<NoteFieldPossession>(
+        [this](const NoteFieldPossession& note) {
+	        mark_dirty(Map::get_index(note.fc, egbase_.map().get_width()));
+	     })),
+     field_terrain_changed_subscriber_(Notifications::subscribe<NoteFieldTerrainChanged>(
+        [this](const NoteFieldTerrainChanged& note) { mark_dirty(note.map_index); })),
+     field_vision_subscriber_(
+        Notifications::subscribe<NoteFieldVision>([this](const NoteFieldVision& note) {
+	        if (note.player == player_number_ && !see_all_) {
+		        mark_dirty(note.map_index);
+	        }
+	     })),
+     immovable_subscriber_(
+        Notifications::subscribe<NoteImmovable>([this](const NoteImmovable& note) {
+	        if (colors_.empty()) {
+		        return;
+	        }
+	        if (note.ownership == NoteImmovable::Ownership::LOST) {
+		        mark_dirty(*note.pi);
+	        } else {
+		        new_immovables_.push_back(note.pi);
+	        }
+	     })) {
+}
+
+void MiniMapCache::mark_dirty(MapIndex const i) {
+	// Nothing to do if all colors will be recalculated anyway.
+	if (i >= is_dirty_.size() || is_dirty_[i]) {
+		return;
+	}
+	is_dirty_[i] = true;
+	dirty_fields_.push_back(i);
+}
+
+void MiniMapCache::mark_dirty(const PlayerImmovable& immovable) {
+	const Map& map = egbase_.map();
+	for (const Coords& coords : immovable.get_positions(egbase_)) {
+		mark_dirty(Map::get_index(coords, map.get_width()));
+	}
+}
+
+const Texture* MiniMapCache::draw(const Player* player,
+                                  const Rectf& view_area,
+                                  MiniMapType minimap_type,
+                                  MiniMapLayer layers) {
+	update_colors(player, layers);
+	if (colors_changed_ || texture_ == nullptr || view_area != view_area_ ||
+	    minimap_type != minimap_type_ || layers != texture_layers_) {
+		update_texture(view_area, minimap_type, layers);
+		colors_changed_ = false;
+	}
+	return texture_.get();
+}
+
+void MiniMapCache::update_colors(const Player* player, MiniMapLayer layers) {
+	const Map& map = egbase_.map();
+	const MiniMapLayer color_layers =
+	   MiniMapLayer(static_cast<int>(layers) &
+	                ~static_cast<int>(MiniMapLayer::Zoom2 | MiniMapLayer::ViewWindow));
+	const PlayerNumber player_number = player != nullptr ? player->player_number() : 0;
+	const bool see_all = player == nullptr || player->see_all();
+
+	// The editor changes heights and resizes the map without sending any
+	// notes, so all fields are recolored there.
+	if (colors_.size() != map.max_index() || player_number != player_number_ ||
+	    see_all != see_all_ || color_layers != color_layers_ || !is_a(Game, &egbase_)) {
+		player_number_ = player_number;
+		see_all_ = see_all;
+		color_layers_ = color_layers;
+		colors_.resize(map.max_index());
+		MapIndex i = 0;
+		for (int16_t y = 0; y < map.get_height(); ++y) {
+			for (int16_t x = 0; x < map.get_width(); ++x, ++i) {
+				colors_[i] = pack_color(
+				   calc_field_color(egbase_, player, map.get_fcoords(Coords(x, y)), i, color_layers));
+			}
+		}
+		dirty_fields_.clear();
+		is_dirty_.assign(map.max_index(), false);
+		new_immovables_.clear();
+		colors_changed_ = true;
+		return;
+	}
+
+	for (const OPtr<PlayerImmovable>& immovable : new_immovables_) {
+		if (const PlayerImmovable* pi = immovable.get(egbase_)) {
+			mark_dirty(*pi);
+		}
+	}
+	new_immovables_.clear();
+
+	for (const MapIndex i : dirty_fields_) {
+		colors_[i] = pack_color(
+		   calc_field_color(egbase_, player, map.get_fcoords(map[i]), i, color_layers_));
+		is_dirty_[i] = false;
+	}
+	colors_changed_ = colors_changed_ || !dirty_fields_.empty();
+	dirty_fields_.clear();
+}
+
+void MiniMapCache::update_texture(const Rectf& view_area,
+                                  MiniMapType minimap_type,
+                                  MiniMapLayer layers) {
+	const Map& map = egbase_.map();
+	const bool zoom = layers & MiniMapLayer::Zoom2;
+	const int map_w = map.get_width();
+	const int map_h = map.get_height();
+	const int width = zoom ? map_w * 2 : map_w;
+	const int height = zoom ? map_h * 2 : map_h;
+
+	if (texture_ == nullptr || texture_->width() != width || texture_->height() != height) {
+		texture_.reset(new Texture(width, height));
+	}
+	pixels_.resize(width * height);
+
+	Coords node = minimap_top_left_node(map, view_area, minimap_type, zoom);
+	map.normalize_coords(node);
+	for (int y = 0; y < height; ++y) {
+		const uint32_t* field_row = &colors_[((node.y + (zoom ? y / 2 : y)) % map_h) * map_w];
+		uint32_t* pixel_row = &pixels_[(height - y - 1) * width];
+		int field_x = node.x;
+		for (int x = 0; x < width; ++x) {
+			if (x % 2 || !zoom) {
+				if (++field_x == map_w) {
+					field_x = 0;
+				}
+			}
+			pixel_row[x] = field_row[field_x];
+		}
+	}
+
+	if (layers & MiniMapLayer::ViewWindow) {
+		const uint32_t red = pack_color(kRed);
+		draw_view_window(
+		   map, view_area, minimap_type, zoom,
+		   [this, width, height, red](int x, int y) { pixels_[(height - y - 1) * width + x] = red; });
+	}
+	texture_->set_pixels(reinterpret_cast<const uint8_t*>(pixels_.data()));
+
+	view_area_ = view_area;
+	minimap_type_ = minimap_type;
+	texture_layers_ = layers;
+}
@@ -21,13 +21,17 @@
 #define WL_GRAPHIC_MINIMAP_RENDERER_H
 
 #include <memory>
+#include <vector>
 
+#include "base/macros.h"
 #include "base/rect.h"
 #include "base/vector.h"
 #include "graphic/texture.h"
 #include "logic/editor_game_base.h"
 #include "logic/map.h"
+#include "logic/map_objects/immovable.h"
 #include "logic/player.h"
+#include "notifications/notifications.h"
 
 // Layers for selecting what do display on the minimap.
 enum class MiniMapLayer {
@@ -78,4 +82,62 @@ std::unique_ptr<Texture> draw_minimap(const Widelands::EditorGameBase& egbase,
                                       const MiniMapType& map_draw_type,
                                       MiniMapLayer layers);
 
+// Renders the minimap like 'draw_minimap', but keeps the color of every field
+// between frames. Only the fields that were reported as changed through
+// notifications since the last call are recolored, and the texture is only
+// rewritten when some color, the view window or the layers changed.
+class MiniMapCache {
+public:
+	explicit MiniMapCache(const Widelands::EditorGameBase& egbase);
+
+	// The returned texture is owned by the cache and stays valid until the next call.
+	const Texture* draw(const Widelands::Player* player,
+	                    const Rectf& view_area,
+	                    MiniMapType minimap_type,
+	                    MiniMapLayer layers);
+
+private:
+	void mark_dirty(Widelands::MapIndex i);
+	void mark_dirty(const Widelands::PlayerImmovable& immovable);
+	void update_colors(const Widelands::Player* player, MiniMapLayer layers);
+	void update_texture(const Rectf& view_area, MiniMapType minimap_type, MiniMapLayer layers);
+
+	const Widelands::EditorGameBase& egbase_;
+
+	// The point of view and the layers that 'colors_' were calculated for.
+	Widelands::PlayerNumber player_number_;
+	bool see_all_;
+	MiniMapLayer color_layers_;
+
+	// The packed color of each field in MapIndex order.
+	std::vector<uint32_t> colors_;
+	bool colors_changed_;
+
+	// Fields that need to be recolored before the next frame.
+	std::vector<Widelands::MapIndex> dirty_fields_;
+	std::vector<bool> is_dirty_;
+
+	// Immovables that got an owner since the last frame. Flags and roads do not
+	// know their positions yet when that is announced, so they are looked up later.
+	std::vector<Widelands::OPtr<Widelands::PlayerImmovable>> new_immovables_;
+
+	// What 'texture_' currently shows.
+	Rectf view_area_;
+	MiniMapType minimap_type_;
+	MiniMapLayer texture_layers_;
+
+	// The pixels of 'texture_', bottom row first.
+	std::vector<uint32_t> pixels_;
+	std::unique_ptr<Texture> texture_;
+
+	std::unique_ptr<Notifications::Subscriber<Widelands::NoteFieldPossession>>
+	   field_possession_subscriber_;
+	std::unique_ptr<Notifications::Subscriber<Widelands::NoteFieldTerrainChanged>>
+	   field_terrain_changed_subscriber_;
+	std::unique_ptr<Notifications::Subscriber<Widelands::NoteFieldVision>> field_vision_subscriber_;
+	std::unique_ptr<Notifications::Subscriber<Widelands::NoteImmovable>> immovable_subscriber_;
+
+	DISALLOW_COPY_AND_ASSIGN(MiniMapCache);
+};
+
 #endif  // end of include guard: WL_GRAPHIC_MINIMAP_RENDERER_H
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <memory>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "graphic/text/transient_cache.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+namespace {
+
+/// Every entry has size 1. The keys are "<hash>:<name>", so that the tests choose which keys
+/// collide.
+class TestCache : public TransientCache<std::string> {
+public:
+	explicit TestCache(uint32_t max_size) : TransientCache<std::string>(max_size) {
+	}
+
+	std::shared_ptr<const std::string> insert(const std::string& hash,
+	                                          std::shared_ptr<const std::string> entry) override {
+		return TransientCache<std::string>::insert(hash, entry, 1);
+	}
+
+	void insert(const std::string& key) {
+		insert(key, std::make_shared<const std::string>(key));
+	}
+
+	/// Whether 'key' is cached with the value that was inserted for it
+	bool has(const std::string& key) {
+		const std::shared_ptr<const std::string> entry = get(key);
+		return entry != nullptr && *entry == key;
+	}
+
+protected:
+	uint64_t hash_key(const std::string& key) const override {
+		return std::stoull(key.substr(0, key.find(':')));
+	}
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TransientCacheTests)
+
+BOOST_AUTO_TEST_CASE(equal_hashes_are_told_apart_by_key) {
+	TestCache cache(100);
+	for (int i = 0; i < 10; ++i) {
+		cache.insert("5:" + std::to_string(i));
+	}
+	BOOST_CHECK_EQUAL(cache.count(), 10U);
+	for (int i = 0; i < 10; ++i) {
+		BOOST_CHECK(cache.has("5:" + std::to_string(i)));
+	}
+	BOOST_CHECK(!cache.has("5:10"));
+	BOOST_CHECK(!cache.has("6:0"));
+}
+
+BOOST_AUTO_TEST_CASE(drop_in_the_middle_of_a_probe_run) {
+	TestCache cache(4);
+	// Slots 5 to 8 in insertion order. "6:c" sits behind its preferred slot.
+	cache.insert("5:a");
+	cache.insert("5:b");
+	cache.insert("6:c");
+	cache.insert("5:d");
+	// Make "5:b" the oldest entry and drop it to make room for "7:e"
+	BOOST_CHECK(cache.has("5:a"));
+	cache.insert("7:e");
+	BOOST_CHECK_EQUAL(cache.statistics().evictions, 1U);
+	BOOST_CHECK(!cache.has("5:b"));
+	for (const char* key : {"5:a", "6:c", "5:d", "7:e"}) {
+		BOOST_CHECK(cache.has(key));
+	}
+	// And once more after the run has been shifted back
+	cache.insert("5:f");
+	BOOST_CHECK(!cache.has("5:a"));
+	for (const char* key : {"6:c", "5:d", "7:e", "5:f"}) {
+		BOOST_CHECK(cache.has(key));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(drop_in_a_probe_run_that_wraps_around_the_table) {
+	TestCache cache(5);
+	// Slots 62, 63, 0, 1 and 2. The initial table has 64 slots.
+	cache.insert("62:a");
+	cache.insert("62:b");
+	cache.insert("63:c");
+	cache.insert("0:d");
+	cache.insert("62:e");
+	for (const char* key : {"62:a", "62:b", "63:c", "0:d", "62:e"}) {
+		BOOST_CHECK(cache.has(key));
+	}
+	// Drop the entries one by one, oldest first
+	cache.insert("1:f");
+	BOOST_CHECK(!cache.has("62:a"));
+	for (const char* key : {"62:b", "63:c", "0:d", "62:e", "1:f"}) {
+		BOOST_CHECK(cache.has(key));
+	}
+	cache.insert("2:g");
+	BOOST_CHECK(!cache.has("62:b"));
+	for (const char* key : {"63:c", "0:d", "62:e", "1:f", "2:g"}) {
+		BOOST_CHECK(cache.has(key));
+	}
+	cache.insert("63:h");
+	BOOST_CHECK(!cache.has("63:c"));
+	for (const char* key : {"0:d", "62:e", "1:f", "2:g", "63:h"}) {
+		BOOST_CHECK(cache.has(key));
+	}
+	BOOST_CHECK_EQUAL(cache.statistics().evictions, 3U);
+}
+
+BOOST_AUTO_TEST_CASE(least_recently_used_is_dropped_first) {
+	TestCache cache(3);
+	cache.insert("1:a");
+	cache.insert("1:b");
+	cache.insert("1:c");
+	BOOST_CHECK_EQUAL(cache.size(), 3U);
+
+	// The order is now b, c, a
+	BOOST_CHECK(cache.get("1:a") != nullptr);
+	// Drops b, leaving c, a, d
+	cache.insert("1:d");
+	BOOST_CHECK(cache.get("1:b") == nullptr);
+	// a, d, c
+	BOOST_CHECK(cache.get("1:c") != nullptr);
+	// Drops a, leaving d, c, e
+	cache.insert("1:e");
+	BOOST_CHECK(cache.get("1:a") == nullptr);
+	BOOST_CHECK(cache.get("1:d") != nullptr);
+	BOOST_CHECK(cache.get("1:c") != nullptr);
+	BOOST_CHECK(cache.get("1:e") != nullptr);
+
+	BOOST_CHECK_EQUAL(cache.statistics().hits, 5U);
+	BOOST_CHECK_EQUAL(cache.statistics().misses, 2U);
+	BOOST_CHECK_EQUAL(cache.statistics().evictions, 2U);
+	BOOST_CHECK_EQUAL(cache.count(), 3U);
+	BOOST_CHECK_EQUAL(cache.size(), 3U);
+
+	// Flushing keeps the statistics
+	cache.flush();
+	BOOST_CHECK_EQUAL(cache.count(), 0U);
+	BOOST_CHECK_EQUAL(cache.size(), 0U);
+	BOOST_CHECK(cache.get("1:e") == nullptr);
+	BOOST_CHECK_EQUAL(cache.statistics().misses, 3U);
+	BOOST_CHECK_EQUAL(cache.statistics().evictions, 2U);
+}
+
+BOOST_AUTO_TEST_CASE(many_collisions_through_growth_and_eviction) {
+	constexpr int kMaxSize = 100;
+	TestCache cache(kMaxSize);
+	// Few distinct hashes, and they keep colliding when the table grows to 256 slots
+	auto key = [](int i) { return std::to_string((i % 7) * 256 + 3) + ":" + std::to_string(i); };
+	for (int i = 0; i < 500; ++i) {
+		cache.insert(key(i));
+		if (i % 50 == 49) {
+			// Only the newest entries are left
+			for (int j = 0; j <= i; ++j) {
+				BOOST_CHECK_EQUAL(cache.has(key(j)), j > i - kMaxSize);
+			}
+		}
+	}
+	BOOST_CHECK_EQUAL(cache.count(), static_cast<uint32_t>(kMaxSize));
+	BOOST_CHECK_EQUAL(cache.statistics().evictions, 400U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
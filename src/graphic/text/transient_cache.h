@@ -21,33 +21,39 @@
 #define WL_GRAPHIC_TEXT_TRANSIENT_CACHE_H
 
 #include <cassert>
-#include <list>
-#include <map>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
-
-#include <SDL.h>
-#include <boost/utility.hpp>
+#include <vector>
 
 #include "base/macros.h"
 
-// The implementation took inspiration from
-// https://timday.bitbucket.io/lru.html, but our use case here is a little
-// different.
-
 /// Caches transient rendered text. The entries will be kept until the memory limit is reached,
 /// then the stalest entries will be deleted to make room for new entries.
 ///
 /// We use shared_ptr so that other objects can hold on to the textures if they need them more
 /// permanently.
+///
+/// Lookups happen many times per frame, so they must not allocate: the keys are hashed to 64 bits
+/// and looked up in an open-addressing table (linear probing), and the access history is an
+/// intrusive doubly linked list threaded through the entries. The full key is still compared on
+/// a hit, so hash collisions cannot return the wrong entry.
 template <typename T> class TransientCache {
 public:
+	struct Statistics {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+	};
+
 	/// Create a new cache in which the combined data size for all transient entries is always below
 	/// the 'max_size_in_arbitrary_unit'.
 	explicit TransientCache(uint32_t max_size_in_arbitrary_unit);
 	virtual ~TransientCache();
 
-	/// Deletes all entries in the cache, leaving it as if it were just created.
+	/// Deletes all entries in the cache, leaving it as if it were just created. The statistics are
+	/// kept.
 	void flush();
 
 	/// Returns an entry if it is cached, nullptr otherwise.
@@ -59,6 +65,21 @@ public:
 	virtual std::shared_ptr<const T> insert(const std::string& hash,
 	                                        std::shared_ptr<const T> entry) = 0;
 
+	uint32_t max_size() const {
+		return max_size_in_size_unit_;
+	}
+	/// The combined size of all cached entries
+	uint32_t size() const {
+		return size_in_size_unit_;
+	}
+	/// The number of cached entries
+	uint32_t count() const {
+		return nr_entries_;
+	}
+	const Statistics& statistics() const {
+		return statistics_;
+	}
+
 protected:
 	/// Inserts this entry of type T into the cache. asserts() that there is no entry with this hash
 	/// already cached. Returns the given T for convenience.
@@ -66,91 +87,231 @@ protected:
 	                                std::shared_ptr<const T> entry,
 	                                uint32_t entry_size_in_size_unit);
 
+	/// 64 bit FNV-1a. Tests override this to force hash collisions.
+	virtual uint64_t hash_key(const std::string& key) const;
+
 private:
-	/// Drop the oldest entry
-	void drop();
+	static constexpr uint32_t kNoEntry = std::numeric_limits<uint32_t>::max();
+	static constexpr size_t kInitialNrSlots = 64;
 
-	using AccessHistory = std::list<std::string>;
 	struct Entry {
+		std::string key;
+		uint64_t key_hash;
 		std::shared_ptr<const T> entry;
 		uint32_t size;
-		uint32_t last_access;  // Mainly for debugging and analysis.
-		const AccessHistory::iterator list_iterator;
+		// Neighbours in the access history
+		uint32_t older;
+		uint32_t newer;
 	};
+	struct Slot {
+		uint64_t key_hash;
+		uint32_t entry;  // Index into 'entries_' or kNoEntry
+	};
+
+	/// Returns the slot holding 'key', or the empty slot where it would have to go.
+	size_t find_slot(const std::string& key, uint64_t key_hash) const;
+	/// Empties the slot and moves later entries of its probe sequence back.
+	void erase_slot(size_t slot);
+	void grow();
+
+	/// Marks the entry as the most recently used one.
+	void link_newest(uint32_t index);
+	void unlink(uint32_t index);
+
+	/// Drop the oldest entry
+	void drop();
 
 	uint32_t max_size_in_size_unit_;
 	uint32_t size_in_size_unit_;
-	std::map<std::string, Entry> entries_;
-	AccessHistory access_history_;
+	uint32_t nr_entries_;
+
+	std::vector<Entry> entries_;
+	std::vector<uint32_t> free_entries_;
+	std::vector<Slot> slots_;  // The size is always a power of 2
+	uint32_t oldest_;
+	uint32_t newest_;
+
+	Statistics statistics_;
 
 	DISALLOW_COPY_AND_ASSIGN(TransientCache);
 };
 
 // Implementation
 
+template <typename T> constexpr uint32_t TransientCache<T>::kNoEntry;
+template <typename T> constexpr size_t TransientCache<T>::kInitialNrSlots;
+
 template <typename T>
 TransientCache<T>::TransientCache(uint32_t max_size_in_arbitrary_unit)
-   : max_size_in_size_unit_(max_size_in_arbitrary_unit), size_in_size_unit_(0) {
+   : max_size_in_size_unit_(max_size_in_arbitrary_unit),
+     size_in_size_unit_(0),
+     nr_entries_(0),
+     slots_(kInitialNrSlots, Slot{0, kNoEntry}),
+     oldest_(kNoEntry),
+     newest_(kNoEntry) {
 }
 template <typename T> TransientCache<T>::~TransientCache() {
 	flush();
 }
 
 template <typename T> void TransientCache<T>::flush() {
-	access_history_.clear();
-	size_in_size_unit_ = 0;
 	entries_.clear();
+	free_entries_.clear();
+	slots_.assign(kInitialNrSlots, Slot{0, kNoEntry});
+	oldest_ = newest_ = kNoEntry;
+	size_in_size_unit_ = 0;
+	nr_entries_ = 0;
 }
 
 /// Returns an entry if it is cached, nullptr otherwise.
 template <typename T> std::shared_ptr<const T> TransientCache<T>::get(const std::string& hash) {
-	const auto it = entries_.find(hash);
-	if (it == entries_.end()) {
+	const Slot& slot = slots_[find_slot(hash, hash_key(hash))];
+	if (slot.entry == kNoEntry) {
+		++statistics_.misses;
 		return std::shared_ptr<const T>(nullptr);
 	}
+	++statistics_.hits;
 
-	// Move this to the back of the access list to signal that we have used this
-	// recently and update last access time.
-	access_history_.splice(access_history_.end(), access_history_, it->second.list_iterator);
-	it->second.last_access = SDL_GetTicks();
-	return it->second.entry;
+	// Move this to the back of the access history to signal that we have used this recently.
+	if (slot.entry != newest_) {
+		unlink(slot.entry);
+		link_newest(slot.entry);
+	}
+	return entries_[slot.entry].entry;
 }
 
 template <typename T>
 std::shared_ptr<const T> TransientCache<T>::insert(const std::string& hash,
                                                    std::shared_ptr<const T> entry,
                                                    uint32_t entry_size_in_size_unit) {
-	assert(entries_.find(hash) == entries_.end());
+	const uint64_t key_hash = hash_key(hash);
+	assert(slots_[find_slot(hash, key_hash)].entry == kNoEntry);
 
-	while (!entries_.empty() &&
-	       size_in_size_unit_ + entry_size_in_size_unit > max_size_in_size_unit_) {
+	// Sum in 64 bit, the budget may be close to the 32 bit limit
+	while (nr_entries_ > 0 && static_cast<uint64_t>(size_in_size_unit_) + entry_size_in_size_unit >
+	                             max_size_in_size_unit_) {
 		drop();
 	}
+	// Keep the load factor at or below 1/2 so that probe sequences stay short.
+	if (2 * (nr_entries_ + 1) > slots_.size()) {
+		grow();
+	}
+
+	uint32_t index;
+	if (free_entries_.empty()) {
+		index = entries_.size();
+		entries_.push_back(Entry());
+	} else {
+		index = free_entries_.back();
+		free_entries_.pop_back();
+	}
+	Entry& new_entry = entries_[index];
+	// Reuses the string buffer of a dropped entry if possible
+	new_entry.key.assign(hash);
+	new_entry.key_hash = key_hash;
+	new_entry.entry = std::move(entry);
+	new_entry.size = entry_size_in_size_unit;
 
-	// Record hash as most-recently-used.
-	AccessHistory::iterator it = access_history_.insert(access_history_.end(), hash);
+	slots_[find_slot(hash, key_hash)] = Slot{key_hash, index};
+	link_newest(index);
 	size_in_size_unit_ += entry_size_in_size_unit;
-	return entries_
-	   .insert(make_pair(hash, Entry{std::move(entry), entry_size_in_size_unit, SDL_GetTicks(), it}))
-	   .first->second.entry;
+	++nr_entries_;
+	return new_entry.entry;
 }
 
-template <typename T> void TransientCache<T>::drop() {
-	assert(!access_history_.empty());
+template <typename T> uint64_t TransientCache<T>::hash_key(const std::string& key) const {
+	uint64_t result = 14695981039346656037ULL;
+	for (const char c : key) {
+		result ^= static_cast<uint8_t>(c);
+		result *= 1099511628211ULL;
+	}
+	return result;
+}
+
+template <typename T>
+size_t TransientCache<T>::find_slot(const std::string& key, uint64_t key_hash) const {
+	const size_t mask = slots_.size() - 1;
+	for (size_t i = key_hash & mask;; i = (i + 1) & mask) {
+		const Slot& slot = slots_[i];
+		if (slot.entry == kNoEntry ||
+		    (slot.key_hash == key_hash && entries_[slot.entry].key == key)) {
+			return i;
+		}
+	}
+}
+
+template <typename T> void TransientCache<T>::erase_slot(size_t slot) {
+	const size_t mask = slots_.size() - 1;
+	for (size_t next = (slot + 1) & mask; slots_[next].entry != kNoEntry; next = (next + 1) & mask) {
+		// An entry may move back into the hole only if its preferred slot is not
+		// cyclically between the hole and its current position.
+		const size_t preferred = slots_[next].key_hash & mask;
+		if (((next - preferred) & mask) >= ((next - slot) & mask)) {
+			slots_[slot] = slots_[next];
+			slot = next;
+		}
+	}
+	slots_[slot].entry = kNoEntry;
+}
+
+template <typename T> void TransientCache<T>::grow() {
+	std::vector<Slot> old_slots(2 * slots_.size(), Slot{0, kNoEntry});
+	old_slots.swap(slots_);
+	const size_t mask = slots_.size() - 1;
+	for (const Slot& slot : old_slots) {
+		if (slot.entry != kNoEntry) {
+			size_t i = slot.key_hash & mask;
+			while (slots_[i].entry != kNoEntry) {
+				i = (i + 1) & mask;
+			}
+			slots_[i] = slot;
+		}
+	}
+}
+
+template <typename T> void TransientCache<T>::link_newest(uint32_t index) {
+	Entry& entry = entries_[index];
+	entry.older = newest_;
+	entry.newer = kNoEntry;
+	if (newest_ == kNoEntry) {
+		oldest_ = index;
+	} else {
+		entries_[newest_].newer = index;
+	}
+	newest_ = index;
+}
+
+template <typename T> void TransientCache<T>::unlink(uint32_t index) {
+	const Entry& entry = entries_[index];
+	if (entry.older == kNoEntry) {
+		oldest_ = entry.newer;
+	} else {
+		entries_[entry.older].newer = entry.newer;
+	}
+	if (entry.newer == kNoEntry) {
+		newest_ = entry.older;
+	} else {
+		entries_[entry.newer].older = entry.older;
+	}
+}
 
-	// Identify least recently used key
-	const auto it = entries_.find(access_history_.front());
-	assert(it != entries_.end());
+template <typename T> void TransientCache<T>::drop() {
+	assert(oldest_ != kNoEntry);
 
-	size_in_size_unit_ -= it->second.size;
-	// TODO(GunChleoc): Remove the following line once everything is converted to the new font
-	// renderer and all testing has been done.
-	// log("TransientCache: Dropping %d bytes, new size %d. Hash: %s\n", it->second.size,
-	//    size_in_size_unit_, it->first.c_str());
+	// Identify least recently used entry
+	const uint32_t index = oldest_;
+	Entry& entry = entries_[index];
+	const size_t slot = find_slot(entry.key, entry.key_hash);
+	assert(slots_[slot].entry == index);
 
-	// Erase both elements to completely purge record
-	entries_.erase(it);
-	access_history_.pop_front();
+	// Erase it from the table and the access history to completely purge the record
+	erase_slot(slot);
+	unlink(index);
+	size_in_size_unit_ -= entry.size;
+	--nr_entries_;
+	entry.entry.reset();
+	free_entries_.push_back(index);
+	++statistics_.evictions;
 }
 
 #endif  // end of include guard: WL_GRAPHIC_TEXT_TRANSIENT_CACHE_H
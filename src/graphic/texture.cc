@@ -248,6 +248,20 @@ void Texture::set_pixel(uint16_t x, uint16_t y, const RGBAColor& color) {
 	*(reinterpret_cast<uint32_t*>(data)) = packed_color;
 }
 
+void Texture::set_pixels(const uint8_t* pixels) {
+	if (blit_data_.texture_id == 0) {
+		return;
+	}
+	assert(!pixels_);
+	if (!owns_texture_) {
+		throw wexception("A surface that does not own its pixels can not be written to.");
+	}
+
+	Gl::State::instance().bind(GL_TEXTURE0, blit_data_.texture_id);
+	glTexSubImage2D(
+	   GL_TEXTURE_2D, 0, 0, 0, width(), height(), GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+}
+
 void Texture::setup_gl() {
 	assert(blit_data_.texture_id != 0);
 	Gl::State::instance().bind_framebuffer(GlFramebuffer::instance().id(), blit_data_.texture_id);
@@ -77,6 +77,11 @@ public:
 	// Sets the pixel to the 'clr'.
 	void set_pixel(uint16_t x, uint16_t y, const RGBAColor& color);
 
+	// Replaces all pixels without reading the old ones back first. 'pixels' holds 4 bytes (red,
+	// green, blue, alpha) per pixel, row by row starting with the bottom row, like OpenGL stores
+	// them. Must not be called while the texture is locked.
+	void set_pixels(const uint8_t* pixels);
+
 private:
 	// Configures OpenGL to draw to this surface.
 	void setup_gl();
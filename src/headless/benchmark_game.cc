@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+// Runs a game without graphics for a given amount of gametime and reports how
+// fast the command queue went. The final sync hash can be compared between
+// builds to make sure that a change did not affect the game simulation. When a
+// replay is given, its recorded sync hashes are checked along the way, and the
+// run stops at the end of the replay.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "base/log.h"
+#include "headless/headless_common.h"
+#include "logic/cmd_queue.h"
+#include "logic/filesystem_constants.h"
+#include "logic/game.h"
+#include "logic/headless_game_controller.h"
+#include "logic/replay.h"
+
+using namespace Widelands;
+
+namespace {
+
+constexpr uint32_t kDefaultMinutes = 30;
+
+const char* command_type_name(QueueCommandTypes const type) {
+	switch (type) {
+	case QueueCommandTypes::kDestroyMapObject:
+		return "DestroyMapObject";
+	case QueueCommandTypes::kAct:
+		return "Act";
+	case QueueCommandTypes::kIncorporate:
+		return "Incorporate";
+	case QueueCommandTypes::kLuaScript:
+		return "LuaScript";
+	case QueueCommandTypes::kLuaCoroutine:
+		return "LuaCoroutine";
+	case QueueCommandTypes::kCalculateStatistics:
+		return "CalculateStatistics";
+	case QueueCommandTypes::kCallEconomyBalance:
+		return "CallEconomyBalance";
+	case QueueCommandTypes::kDeleteMessage:
+		return "DeleteMessage";
+	case QueueCommandTypes::kNetCheckSync:
+		return "NetCheckSync";
+	case QueueCommandTypes::kReplaySyncWrite:
+		return "ReplaySyncWrite";
+	case QueueCommandTypes::kReplaySyncRead:
+		return "ReplaySyncRead";
+	case QueueCommandTypes::kReplayEnd:
+		return "ReplayEnd";
+	default:
+		return "PlayerCommand";
+	}
+}
+
+void report(const Game& game, uint32_t const gametime, double const seconds) {
+	const CmdQueue& cmdqueue = game.cmdqueue();
+	const uint64_t nr_commands = cmdqueue.nr_executed_commands();
+	log("\n");
+	log("Simulated gametime: %u ms in %.2f s (%.1fx realtime)\n", gametime, seconds,
+	    seconds > 0 ? gametime / 1000. / seconds : 0.);
+	log("Commands:           %llu (%.0f per second)\n", static_cast<unsigned long long>(nr_commands),
+	    seconds > 0 ? nr_commands / seconds : 0.);
+
+	// Most expensive command types first
+	std::vector<std::pair<QueueCommandTypes, CmdQueue::CommandTypeStatistics>> profile(
+	   cmdqueue.profile().begin(), cmdqueue.profile().end());
+	std::sort(profile.begin(), profile.end(),
+	          [](const std::pair<QueueCommandTypes, CmdQueue::CommandTypeStatistics>& a,
+	             const std::pair<QueueCommandTypes, CmdQueue::CommandTypeStatistics>& b) {
+		          return a.second.nanoseconds > b.second.nanoseconds;
+		       });
+	log("\n%-22s %4s %12s %12s %12s\n", "Command type", "id", "count", "total ms", "avg us");
+	for (const auto& entry : profile) {
+		const CmdQueue::CommandTypeStatistics& stats = entry.second;
+		log("%-22s %4u %12llu %12.1f %12.2f\n", command_type_name(entry.first),
+		    static_cast<unsigned int>(entry.first), static_cast<unsigned long long>(stats.count),
+		    stats.nanoseconds / 1e6, stats.count ? stats.nanoseconds / 1e3 / stats.count : 0.);
+	}
+
+	log("\nSync hash: %s\n", game.get_sync_hash().str().c_str());
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+	if (argc < 2 || argc > 3) {
+		log("Usage: %s <map, savegame or replay> [minutes of gametime, default %u]\n", argv[0],
+		    kDefaultMinutes);
+		return 1;
+	}
+
+	const std::string path = argv[1];
+	uint32_t minutes = kDefaultMinutes;
+	if (argc == 3 && !parse_positive_number(argv[2], "minutes", &minutes)) {
+		return 1;
+	}
+
+	bool lost_sync = false;
+	try {
+		initialize_headless();
+		const std::string filename = add_file_system_for(path);
+
+		Game game;
+		game.set_write_replay(false);
+		HeadlessGameController ctrl(game);
+		game.set_game_controller(&ctrl);
+
+		if (boost::algorithm::ends_with(filename, kReplayExtension)) {
+			std::unique_ptr<ReplayReader> replay(new ReplayReader(game, filename));
+			game.start_headless(Game::Loaded, "");
+			ctrl.set_replay(std::move(replay));
+		} else if (boost::algorithm::ends_with(filename, kSavegameExtension)) {
+			start_saved_game(game, filename);
+		} else {
+			start_new_game(game, filename);
+		}
+
+		const uint32_t start_time = game.get_gametime();
+		game.cmdqueue().set_profiling(true);
+
+		const auto start = std::chrono::steady_clock::now();
+		ctrl.run_until(gametime_after_minutes(start_time, minutes));
+		const double seconds =
+		   std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		lost_sync = ctrl.was_stopped();
+		if (lost_sync) {
+			log("The game was stopped at gametime %u, the replay went out of sync.\n",
+			    game.get_gametime());
+		}
+		if (ctrl.replay_ended()) {
+			log("The replay ended at gametime %u.\n", ctrl.replay_end_time());
+		}
+		report(game, game.get_gametime() - start_time, seconds);
+
+		game.set_game_controller(nullptr);
+		game.cleanup_objects();
+	} catch (std::exception& e) {
+		log("Exception: %s.\n", e.what());
+		cleanup_headless();
+		return 1;
+	}
+	cleanup_headless();
+	return lost_sync ? 2 : 0;
+}
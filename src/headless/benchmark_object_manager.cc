@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+// Measures how long ObjectManager::object_still_available() takes compared to
+// a linear search through all live objects, which is what it used to do.
+// Half of the objects are removed first, so that half of the queries fail.
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+
+#include "base/log.h"
+#include "logic/map_objects/map_object.h"
+
+using namespace Widelands;
+
+namespace {
+
+constexpr uint32_t kDefaultObjects = 20000;
+constexpr uint32_t kDefaultQueries = 2000;
+
+/// Minimal map object that only exists to be registered with the ObjectManager
+class BenchmarkMapObject : public MapObject {
+public:
+	BenchmarkMapObject() : MapObject(nullptr) {
+	}
+	~BenchmarkMapObject() override {
+	}
+};
+
+using BenchmarkObjects = std::vector<std::unique_ptr<BenchmarkMapObject>>;
+
+bool linear_still_available(const BenchmarkObjects& live, const MapObject* const t) {
+	for (const auto& object : live) {
+		if (object.get() == t) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool parse_count(const char* arg, const char* what, uint32_t* result) {
+	try {
+		// lexical_cast happily wraps negative numbers around
+		const int64_t value = boost::lexical_cast<int64_t>(arg);
+		if (value > 0 && value <= UINT32_MAX) {
+			*result = static_cast<uint32_t>(value);
+			return true;
+		}
+	} catch (const boost::bad_lexical_cast&) {
+	}
+	log("Invalid number of %s: %s\n", what, arg);
+	return false;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+	if (argc > 3) {
+		log("Usage: %s [objects, default %u] [queries, default %u]\n", argv[0], kDefaultObjects,
+		    kDefaultQueries);
+		return 1;
+	}
+	uint32_t num_objects = kDefaultObjects;
+	uint32_t num_queries = kDefaultQueries;
+	if ((argc > 1 && !parse_count(argv[1], "objects", &num_objects)) ||
+	    (argc > 2 && !parse_count(argv[2], "queries", &num_queries))) {
+		return 1;
+	}
+	if (num_objects / 2 < num_queries) {
+		log("There must be at least twice as many objects as queries.\n");
+		return 1;
+	}
+
+	ObjectManager manager;
+	BenchmarkObjects removed;
+	BenchmarkObjects live;
+	for (uint32_t i = 0; i < num_objects; ++i) {
+		std::unique_ptr<BenchmarkMapObject> object(new BenchmarkMapObject());
+		manager.insert(object.get());
+		if (i % 2) {
+			manager.remove(*object);
+			removed.push_back(std::move(object));
+		} else {
+			live.push_back(std::move(object));
+		}
+	}
+
+	// Alternate between live and removed objects, spread over the whole range
+	std::vector<const MapObject*> queries;
+	const uint32_t stride = removed.size() / num_queries;
+	for (uint32_t i = 0; i < num_queries; ++i) {
+		queries.push_back(i % 2 ? removed[i * stride].get() : live[i * stride].get());
+	}
+
+	const auto start_indexed = std::chrono::steady_clock::now();
+	uint32_t found_indexed = 0;
+	for (const MapObject* query : queries) {
+		found_indexed += manager.object_still_available(query, query->serial()) ? 1 : 0;
+	}
+	const auto start_linear = std::chrono::steady_clock::now();
+	uint32_t found_linear = 0;
+	for (const MapObject* query : queries) {
+		found_linear += linear_still_available(live, query) ? 1 : 0;
+	}
+	const auto end = std::chrono::steady_clock::now();
+
+	log("object_still_available: %u queries on %u live objects: indexed %lld us, linear %lld us\n",
+	    num_queries, static_cast<uint32_t>(live.size()),
+	    static_cast<long long>(
+	       std::chrono::duration_cast<std::chrono::microseconds>(start_linear - start_indexed)
+	          .count()),
+	    static_cast<long long>(
+	       std::chrono::duration_cast<std::chrono::microseconds>(end - start_linear).count()));
+
+	for (const auto& object : live) {
+		manager.remove(*object);
+	}
+	if (found_indexed != found_linear || found_indexed != (num_queries + 1) / 2) {
+		log("Results differ: indexed found %u, linear found %u objects.\n", found_indexed,
+		    found_linear);
+		return 2;
+	}
+	return 0;
+}
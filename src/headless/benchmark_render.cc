@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+// Measures how long it takes to prepare the fields of a map view for drawing,
+// without a window or GPU. The view is moved along a few typical camera
+// paths, once with the FieldsToDraw cache and once recalculating everything
+// on each frame, and the results of both are checked to be the same.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "base/log.h"
+#include "base/macros.h"
+#include "base/rect.h"
+#include "base/vector.h"
+#include "graphic/gl/fields_to_draw.h"
+#include "headless/headless_common.h"
+#include "logic/filesystem_constants.h"
+#include "logic/game.h"
+#include "logic/headless_game_controller.h"
+#include "wui/mapviewpixelconstants.h"
+
+using namespace Widelands;
+
+namespace {
+
+constexpr uint32_t kDefaultFrames = 1000;
+
+// Size of the simulated main window
+constexpr int kViewWidth = 1920;
+constexpr int kViewHeight = 1080;
+
+enum class CameraPath { kStatic, kSlowScroll, kFastScroll, kJumps };
+
+const char* camera_path_name(CameraPath const path) {
+	switch (path) {
+	case CameraPath::kStatic:
+		return "static";
+	case CameraPath::kSlowScroll:
+		return "slow scroll";
+	case CameraPath::kFastScroll:
+		return "fast scroll";
+	case CameraPath::kJumps:
+		return "jumps";
+	}
+	NEVER_HERE();
+}
+
+// Returns the viewpoint of the camera in 'frame', normalized to the map.
+Vector2f viewpoint_for(const Map& map, CameraPath const path, uint32_t const frame) {
+	const float map_w = map.get_width() * kTriangleWidth;
+	const float map_h = map.get_height() * kTriangleHeight;
+	Vector2f viewpoint = Vector2f::zero();
+	switch (path) {
+	case CameraPath::kStatic:
+		break;
+	case CameraPath::kSlowScroll:
+		viewpoint = Vector2f(3.f * frame, 2.f * frame);
+		break;
+	case CameraPath::kFastScroll:
+		viewpoint = Vector2f(40.f * frame, 25.f * frame);
+		break;
+	case CameraPath::kJumps: {
+		// Stay for a while at each place, like a player clicking on the minimap.
+		const uint32_t place = frame / 20;
+		viewpoint = Vector2f((place * 7919u) % 100000, (place * 104729u) % 100000);
+		break;
+	}
+	}
+	return Vector2f(std::fmod(viewpoint.x, map_w), std::fmod(viewpoint.y, map_h));
+}
+
+// Returns the number of fields that differ between 'a' and 'b'.
+uint32_t count_differences(const FieldsToDraw& a, const FieldsToDraw& b) {
+	if (a.size() != b.size()) {
+		return std::max(a.size(), b.size());
+	}
+	uint32_t result = 0;
+	for (size_t i = 0; i < a.size(); ++i) {
+		const FieldsToDraw::Field& fa = a.at(i);
+		const FieldsToDraw::Field& fb = b.at(i);
+		if (fa.geometric_coords != fb.geometric_coords || fa.fcoords.field != fb.fcoords.field ||
+		    fa.gl_position != fb.gl_position || fa.rendertarget_pixel != fb.rendertarget_pixel ||
+		    fa.texture_coords != fb.texture_coords || fa.brightness != fb.brightness ||
+		    fa.roads != fb.roads || fa.owner != fb.owner || fa.ln_index != fb.ln_index ||
+		    fa.rn_index != fb.rn_index || fa.trn_index != fb.trn_index ||
+		    fa.bln_index != fb.bln_index || fa.brn_index != fb.brn_index) {
+			++result;
+		}
+	}
+	return result;
+}
+
+// Returns false if the cached and the uncached fields were different.
+bool run_camera_path(const Game& game, CameraPath const path, uint32_t const frames) {
+	FieldsToDraw cached;
+	FieldsToDraw uncached;
+	uncached.set_cache_enabled(false);
+
+	const Recti rect(0, 0, kViewWidth, kViewHeight);
+	double cached_seconds = 0.;
+	double uncached_seconds = 0.;
+	uint32_t differences = 0;
+	for (uint32_t frame = 0; frame < frames; ++frame) {
+		const Vector2f viewpoint = viewpoint_for(game.map(), path, frame);
+
+		auto start = std::chrono::steady_clock::now();
+		cached.reset(game, viewpoint, 1.f, rect, Vector2i::zero(), kViewWidth, kViewHeight);
+		cached_seconds +=
+		   std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		start = std::chrono::steady_clock::now();
+		uncached.reset(game, viewpoint, 1.f, rect, Vector2i::zero(), kViewWidth, kViewHeight);
+		uncached_seconds +=
+		   std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		differences += count_differences(cached, uncached);
+	}
+
+	log("%-12s %12.3f %12.3f %8.2fx %12u\n", camera_path_name(path), cached_seconds * 1e3 / frames,
+	    uncached_seconds * 1e3 / frames, cached_seconds > 0 ? uncached_seconds / cached_seconds : 0.,
+	    differences);
+	return differences == 0;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+	if (argc < 2 || argc > 3) {
+		log("Usage: %s <map or savegame> [frames per camera path, default %u]\n", argv[0],
+		    kDefaultFrames);
+		return 1;
+	}
+
+	const std::string path = argv[1];
+	uint32_t frames = kDefaultFrames;
+	if (argc == 3 && !parse_positive_number(argv[2], "frames", &frames)) {
+		return 1;
+	}
+
+	bool identical = true;
+	try {
+		initialize_headless();
+		const std::string filename = add_file_system_for(path);
+
+		Game game;
+		game.set_write_replay(false);
+		HeadlessGameController ctrl(game);
+		game.set_game_controller(&ctrl);
+
+		if (boost::algorithm::ends_with(filename, kSavegameExtension)) {
+			start_saved_game(game, filename);
+		} else {
+			start_new_game(game, filename);
+		}
+
+		log("\nPreparing %u frames of %dx%d pixels per camera path\n", frames, kViewWidth,
+		    kViewHeight);
+		log("\n%-12s %12s %12s %9s %12s\n", "Camera path", "cached ms", "full ms", "speedup",
+		    "differences");
+		for (CameraPath camera_path : {CameraPath::kStatic, CameraPath::kSlowScroll,
+		                               CameraPath::kFastScroll, CameraPath::kJumps}) {
+			identical &= run_camera_path(game, camera_path, frames);
+		}
+
+		game.set_game_controller(nullptr);
+		game.cleanup_objects();
+	} catch (std::exception& e) {
+		log("Exception: %s.\n", e.what());
+		cleanup_headless();
+		return 1;
+	}
+	cleanup_headless();
+	return identical ? 0 : 2;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "headless/headless_common.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <SDL.h>
+#include <boost/lexical_cast.hpp>
+
+#include "base/i18n.h"
+#include "base/log.h"
+#include "base/wexception.h"
+#include "config.h"
+#include "game_io/game_loader.h"
+#include "game_io/game_preload_packet.h"
+#include "graphic/graphic.h"
+#include "io/filesystem/filesystem.h"
+#include "io/filesystem/layered_filesystem.h"
+#include "logic/game.h"
+#include "logic/game_settings.h"
+#include "logic/map.h"
+#include "logic/map_objects/tribes/tribe_basic_info.h"
+#include "map_io/map_loader.h"
+#include "sound/sound_handler.h"
+
+using namespace Widelands;
+
+void initialize_headless() {
+	i18n::set_locale("en");
+
+	if (SDL_Init(SDL_INIT_TIMER) != 0) {
+		throw wexception("Unable to initialize SDL: %s", SDL_GetError());
+	}
+
+	g_fs = new LayeredFileSystem();
+	g_fs->add_file_system(&FileSystem::create(INSTALL_DATADIR));
+
+	SoundHandler::disable_backend();
+
+	// Nothing is drawn, but the tribes need the animation metadata and styles
+	g_gr = new Graphic();
+	g_gr->initialize_headless();
+}
+
+std::string add_file_system_for(const std::string& path) {
+	std::string dir = FileSystem::fs_dirname(path);
+	if (dir.empty()) {
+		dir = ".";
+	}
+	g_fs->add_file_system(&FileSystem::create(dir));
+	return FileSystem::fs_filename(path.c_str());
+}
+
+void start_new_game(Game& game, const std::string& mapfilename) {
+	GameSettings settings;
+	settings.mapfilename = mapfilename;
+	settings.win_condition_script = "scripting/win_conditions/endless_game.lua";
+
+	Map map;
+	std::unique_ptr<MapLoader> ml(map.get_correct_loader(mapfilename));
+	if (!ml) {
+		throw wexception("%s is not a map, savegame or replay", mapfilename.c_str());
+	}
+	ml->preload_map(true);
+
+	const std::vector<std::string> tribenames = get_all_tribenames();
+	for (PlayerNumber p = 1; p <= map.get_nrplayers(); ++p) {
+		PlayerSettings player;
+		player.state = PlayerSettings::State::kComputer;
+		player.initialization_index = 0;
+		player.name = map.get_scenario_player_name(p);
+		player.tribe = tribenames.at((p - 1) % tribenames.size());
+		player.random_tribe = false;
+		player.ai = "normal";
+		player.random_ai = false;
+		player.team = 0;
+		player.closeable = false;
+		player.shared_in = 0;
+		settings.players.push_back(player);
+	}
+
+	game.init_newgame(nullptr, settings);
+	game.start_headless(Game::NewNonScenario, "");
+}
+
+void start_saved_game(Game& game, const std::string& filename) {
+	{
+		GameLoader gl(filename, game);
+		GamePreloadPacket gpdp;
+		gl.preload_game(gpdp);
+		game.set_win_condition_displayname(gpdp.get_win_condition());
+		gl.load_game();
+	}
+	game.start_headless(Game::Loaded, "");
+}
+
+void cleanup_headless() {
+	if (g_gr) {
+		delete g_gr;
+		g_gr = nullptr;
+	}
+
+	if (g_fs) {
+		delete g_fs;
+		g_fs = nullptr;
+	}
+
+	SDL_Quit();
+}
+
+bool parse_positive_number(const char* arg, const char* what, uint32_t* result) {
+	try {
+		// Parse into a wider signed type, because lexical_cast<uint32_t> wraps "-1" around
+		const int64_t value = boost::lexical_cast<int64_t>(arg);
+		if (value > 0 && value <= std::numeric_limits<uint32_t>::max()) {
+			*result = static_cast<uint32_t>(value);
+			return true;
+		}
+	} catch (const boost::bad_lexical_cast&) {
+	}
+	log("Invalid number of %s: %s\n", what, arg);
+	return false;
+}
+
+uint32_t gametime_after_minutes(uint32_t const start_time, uint32_t const minutes) {
+	const uint64_t end_time = start_time + static_cast<uint64_t>(minutes) * 60 * 1000;
+	return std::min<uint64_t>(end_time, std::numeric_limits<uint32_t>::max());
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_HEADLESS_HEADLESS_COMMON_H
+#define WL_HEADLESS_HEADLESS_COMMON_H
+
+#include <cstdint>
+#include <string>
+
+namespace Widelands {
+class Game;
+}  // namespace Widelands
+
+// Setup the static objects that a game needs to run without user interface.
+// No window is opened and no images or sounds are loaded.
+void initialize_headless();
+
+// Makes the directory of 'path' available to the game and returns the file name in it,
+// so that maps, savegames and replays can be given with their paths on the command line.
+std::string add_file_system_for(const std::string& path);
+
+// Sets up a new game on the map in which every player slot is taken by the AI
+void start_new_game(Widelands::Game& game, const std::string& mapfilename);
+
+// Loads the savegame into the game and starts it
+void start_saved_game(Widelands::Game& game, const std::string& filename);
+
+// Cleanup before program end
+void cleanup_headless();
+
+// Parses a positive number given on the command line. Logs an error and returns
+// false if 'arg' is no number or does not fit into 'result'.
+bool parse_positive_number(const char* arg, const char* what, uint32_t* result);
+
+// Returns the gametime 'minutes' after 'start_time', clamped to the latest gametime.
+uint32_t gametime_after_minutes(uint32_t start_time, uint32_t minutes);
+
+#endif  // end of include guard: WL_HEADLESS_HEADLESS_COMMON_H
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+// Runs a game without graphics as fast as possible, for example to train the
+// AI. All players are controlled by the AI in training mode. When the given
+// amount of gametime has been simulated, the final savegame, the DNA of each
+// AI player and the players' general statistics are written to the output
+// directory.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include "base/log.h"
+#include "base/wexception.h"
+#include "headless/headless_common.h"
+#include "io/filesystem/disk_filesystem.h"
+#include "io/filesystem/layered_filesystem.h"
+#include "io/filewrite.h"
+#include "logic/ai_dna_handler.h"
+#include "logic/filesystem_constants.h"
+#include "logic/game.h"
+#include "logic/headless_game_controller.h"
+#include "logic/player.h"
+#include "logic/save_handler.h"
+
+using namespace Widelands;
+
+namespace {
+
+const std::string kStatisticsFilename = "statistics.csv";
+const std::string kFinalSavegame = std::string("final") + kSavegameExtension;
+
+// Everything the game writes, including the AI's DNA, ends up in 'dir'
+void set_output_directory(const std::string& dir) {
+	std::unique_ptr<FileSystem> home(new RealFSImpl(dir));
+	home->ensure_directory_exists(".");
+	g_fs->set_home_file_system(home.release());
+}
+
+uint32_t last_sample(const std::vector<uint32_t>& samples) {
+	return samples.empty() ? 0 : samples.back();
+}
+
+// Writes the latest sample of each player's general statistics as one CSV line
+void write_statistics(const Game& game) {
+	FileWrite fw;
+	fw.text("player,name,tribe,land_size,nr_workers,nr_buildings,nr_wares,productivity,"
+	        "nr_casualties,nr_kills,nr_msites_lost,nr_msites_defeated,nr_civil_blds_lost,"
+	        "nr_civil_blds_defeated,military_strength\n");
+	const Game::GeneralStatsVector& stats = game.get_general_statistics();
+	const PlayerNumber nr_players = game.map().get_nrplayers();
+	iterate_players_existing_const(p, nr_players, game, player) {
+		if (p > stats.size()) {
+			continue;
+		}
+		const Game::GeneralStats& s = stats.at(p - 1);
+		fw.print_f("%u,%s,%s,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u\n", static_cast<unsigned int>(p),
+		           player->get_name().c_str(), player->tribe().name().c_str(),
+		           last_sample(s.land_size), last_sample(s.nr_workers),
+		           last_sample(s.nr_buildings), last_sample(s.nr_wares),
+		           last_sample(s.productivity), last_sample(s.nr_casualties),
+		           last_sample(s.nr_kills), last_sample(s.nr_msites_lost),
+		           last_sample(s.nr_msites_defeated), last_sample(s.nr_civil_blds_lost),
+		           last_sample(s.nr_civil_blds_defeated), last_sample(s.miltary_strength));
+	}
+	fw.write(*g_fs, kStatisticsFilename);
+}
+
+void dump_ai_dna(Game& game) {
+	AiDnaHandler dna_handler;
+	const PlayerNumber nr_players = game.map().get_nrplayers();
+	iterate_players_existing(p, nr_players, game, player) {
+		Player::AiPersistentState* ai_data = player->get_mutable_ai_persistent_state();
+		if (ai_data->initialized) {
+			dna_handler.dump_output(ai_data, p);
+		}
+	}
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+	if (argc != 4) {
+		log("Usage: %s <map or savegame> <minutes of gametime> <output directory>\n", argv[0]);
+		return 1;
+	}
+
+	const std::string path = argv[1];
+	uint32_t minutes = 0;
+	if (!parse_positive_number(argv[2], "minutes", &minutes)) {
+		return 1;
+	}
+
+	try {
+		initialize_headless();
+		set_output_directory(argv[3]);
+		const std::string filename = add_file_system_for(path);
+
+		Game game;
+		game.set_write_replay(false);
+		game.set_ai_training_mode(true);
+		HeadlessGameController ctrl(game);
+		game.set_game_controller(&ctrl);
+
+		if (boost::algorithm::ends_with(filename, kSavegameExtension)) {
+			start_saved_game(game, filename);
+		} else {
+			start_new_game(game, filename);
+		}
+
+		ctrl.run_until(gametime_after_minutes(game.get_gametime(), minutes));
+		log("Simulation ended at gametime %u\n", game.get_gametime());
+
+		std::string error;
+		if (!game.save_handler().save_game(game, kFinalSavegame, &error)) {
+			throw wexception("Could not save the game: %s", error.c_str());
+		}
+		dump_ai_dna(game);
+		write_statistics(game);
+
+		game.set_game_controller(nullptr);
+		game.cleanup_objects();
+	} catch (std::exception& e) {
+		log("Exception: %s.\n", e.what());
+		cleanup_headless();
+		return 1;
+	}
+	cleanup_headless();
+	return 0;
+}
@@ -58,6 +58,12 @@ public:
 
 	virtual void* load(const std::string& fname, size_t& length) = 0;
 
+	/// Hints that the given files are going to be load()ed soon. File systems
+	/// that can decompress files in the background start doing so. The default
+	/// implementation does nothing.
+	virtual void prefetch(const std::vector<std::string>& /* fnames */) {
+	}
+
 	virtual void write(const std::string& fname, void const* data, int32_t length) = 0;
 	virtual void ensure_directory_exists(const std::string& fs_dirname) = 0;
 	// TODO(unknown): use this only from inside ensure_directory_exists()
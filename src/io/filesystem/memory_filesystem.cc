@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "io/filesystem/memory_filesystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include "base/wexception.h"
+#include "io/streamwrite.h"
+
+namespace {
+// Everything before the last '/' in 'full_path'.
+std::string parent_directory(const std::string& full_path) {
+	const size_t last_separator = full_path.rfind('/');
+	return last_separator == std::string::npos ? "" : full_path.substr(0, last_separator);
+}
+}  // namespace
+
+class MemoryFilesystem::MemoryStreamWrite : public StreamWrite {
+public:
+	explicit MemoryStreamWrite(std::string* file) : file_(file) {
+	}
+
+	void data(const void* const write_data, const size_t size) override {
+		file_->append(static_cast<const char*>(write_data), size);
+	}
+
+private:
+	// Owned by 'Contents', and std::map does not invalidate pointers to its values.
+	std::string* file_;
+};
+
+MemoryFilesystem::MemoryFilesystem() : contents_(new Contents()), basedir_() {
+}
+
+MemoryFilesystem::MemoryFilesystem(const std::shared_ptr<Contents>& contents,
+                                   const std::string& basedir)
+   : contents_(contents), basedir_(basedir) {
+}
+
+std::string MemoryFilesystem::full_path(const std::string& path) const {
+	std::string input = basedir_ + "/" + path;
+	std::replace(input.begin(), input.end(), '\\', '/');
+
+	std::string result;
+	size_t begin = 0;
+	while (begin < input.size()) {
+		size_t end = input.find('/', begin);
+		if (end == std::string::npos) {
+			end = input.size();
+		}
+		const std::string component = input.substr(begin, end - begin);
+		if (component == "..") {
+			const size_t last_separator = result.rfind('/');
+			result.erase(last_separator == std::string::npos ? 0 : last_separator);
+		} else if (!component.empty() && component != ".") {
+			if (!result.empty()) {
+				result += '/';
+			}
+			result += component;
+		}
+		begin = end + 1;
+	}
+	return result;
+}
+
+void MemoryFilesystem::add_directories(const std::string& full_path) {
+	for (size_t end = full_path.find('/'); end != std::string::npos;
+	     end = full_path.find('/', end + 1)) {
+		contents_->directories.insert(full_path.substr(0, end));
+	}
+	if (!full_path.empty()) {
+		contents_->directories.insert(full_path);
+	}
+}
+
+FilenameSet MemoryFilesystem::list_directory(const std::string& path) const {
+	std::string prefix = full_path(path);
+	if (!prefix.empty()) {
+		prefix += '/';
+	}
+	const size_t strip = basedir_.empty() ? 0 : basedir_.size() + 1;
+
+	FilenameSet results;
+	const auto insert_children = [&prefix, strip, &results](const std::string& entry) {
+		if (entry.compare(0, prefix.size(), prefix) == 0 &&
+		    entry.find('/', prefix.size()) == std::string::npos) {
+			results.insert(entry.substr(strip));
+		}
+	};
+	for (const auto& file : contents_->files) {
+		insert_children(file.first);
+	}
+	for (const std::string& directory : contents_->directories) {
+		insert_children(directory);
+	}
+	return results;
+}
+
+bool MemoryFilesystem::is_writable() const {
+	return true;
+}
+
+bool MemoryFilesystem::is_directory(const std::string& path) {
+	const std::string key = full_path(path);
+	return key.empty() || contents_->directories.count(key) == 1;
+}
+
+bool MemoryFilesystem::file_exists(const std::string& path) const {
+	const std::string key = full_path(path);
+	return key.empty() || contents_->files.count(key) == 1 ||
+	       contents_->directories.count(key) == 1;
+}
+
+void* MemoryFilesystem::load(const std::string& fname, size_t& length) {
+	const auto it = contents_->files.find(full_path(fname));
+	if (it == contents_->files.end()) {
+		throw FileNotFoundError("MemoryFilesystem::load", fname);
+	}
+	length = it->second.size();
+	// Like the other file systems, add a terminating zero byte.
+	char* const result = static_cast<char*>(malloc(length + 1));
+	if (result == nullptr) {
+		throw std::bad_alloc();
+	}
+	memcpy(result, it->second.data(), length);
+	result[length] = 0;
+	return result;
+}
+
+void MemoryFilesystem::write(const std::string& fname, void const* const data,
+                             int32_t const length) {
+	const std::string key = full_path(fname);
+	if (contents_->directories.count(key) == 1) {
+		throw FileTypeError("MemoryFilesystem::write", fname, "is a directory");
+	}
+	add_directories(parent_directory(key));
+	contents_->files[key].assign(static_cast<const char*>(data), length);
+}
+
+void MemoryFilesystem::ensure_directory_exists(const std::string& dirname) {
+	const std::string key = full_path(dirname);
+	if (contents_->files.count(key) == 1) {
+		throw FileTypeError("MemoryFilesystem::ensure_directory_exists", dirname,
+		                    "a file with this name already exists");
+	}
+	add_directories(key);
+}
+
+void MemoryFilesystem::make_directory(const std::string& dirname) {
+	if (file_exists(dirname)) {
+		throw FileError("MemoryFilesystem::make_directory", dirname, "already exists");
+	}
+	ensure_directory_exists(dirname);
+}
+
+StreamRead* MemoryFilesystem::open_stream_read(const std::string&) {
+	throw wexception("MemoryFilesystem::open_stream_read is not implemented yet");
+}
+
+StreamWrite* MemoryFilesystem::open_stream_write(const std::string& fname) {
+	const std::string key = full_path(fname);
+	add_directories(parent_directory(key));
+	std::string& file = contents_->files[key];
+	file.clear();
+	return new MemoryStreamWrite(&file);
+}
+
+FileSystem* MemoryFilesystem::make_sub_file_system(const std::string& dirname) {
+	if (!is_directory(dirname)) {
+		throw FileTypeError("MemoryFilesystem::make_sub_file_system", dirname, "is not a directory");
+	}
+	return new MemoryFilesystem(contents_, full_path(dirname));
+}
+
+FileSystem* MemoryFilesystem::create_sub_file_system(const std::string& dirname, Type) {
+	if (file_exists(dirname)) {
+		throw FileError("MemoryFilesystem::create_sub_file_system", dirname,
+		                "path already exists, cannot create new filesystem from it");
+	}
+	ensure_directory_exists(dirname);
+	return new MemoryFilesystem(contents_, full_path(dirname));
+}
+
+void MemoryFilesystem::fs_unlink(const std::string& fs_filename) {
+	const std::string key = full_path(fs_filename);
+	contents_->files.erase(key);
+	if (contents_->directories.erase(key) == 1) {
+		const std::string prefix = key + "/";
+		const auto in_directory = [&prefix](const std::string& entry) {
+			return entry.compare(0, prefix.size(), prefix) == 0;
+		};
+		for (auto it = contents_->files.lower_bound(prefix);
+		     it != contents_->files.end() && in_directory(it->first);) {
+			it = contents_->files.erase(it);
+		}
+		for (auto it = contents_->directories.lower_bound(prefix);
+		     it != contents_->directories.end() && in_directory(*it);) {
+			it = contents_->directories.erase(it);
+		}
+	}
+}
+
+void MemoryFilesystem::fs_rename(const std::string&, const std::string&) {
+	throw wexception("rename inside memory FS is not implemented yet");
+}
+
+unsigned long long MemoryFilesystem::disk_space() {
+	return 0;
+}
+
+std::string MemoryFilesystem::get_basename() {
+	return basedir_;
+}
+
+void MemoryFilesystem::copy_to(FileSystem& target) const {
+	const std::string prefix = basedir_.empty() ? "" : basedir_ + "/";
+	const auto relative_path = [&prefix](const std::string& entry, std::string* result) {
+		if (entry.size() > prefix.size() && entry.compare(0, prefix.size(), prefix) == 0) {
+			*result = entry.substr(prefix.size());
+			return true;
+		}
+		return false;
+	};
+
+	std::string path;
+	// std::set sorts parent directories before their children, so we never need
+	// to create more than one level at once.
+	for (const std::string& directory : contents_->directories) {
+		if (relative_path(directory, &path)) {
+			target.make_directory(path);
+		}
+	}
+	for (const auto& file : contents_->files) {
+		if (relative_path(file.first, &path)) {
+			assert(file.second.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()));
+			target.write(path, file.second.data(), file.second.size());
+		}
+	}
+}
+
+size_t MemoryFilesystem::size() const {
+	size_t result = 0;
+	for (const auto& file : contents_->files) {
+		result += file.second.size();
+	}
+	return result;
+}
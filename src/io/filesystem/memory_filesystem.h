@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_IO_FILESYSTEM_MEMORY_FILESYSTEM_H
+#define WL_IO_FILESYSTEM_MEMORY_FILESYSTEM_H
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "io/filesystem/filesystem.h"
+
+/**
+ * A writable file system that keeps all files in memory.
+ *
+ * Used to take a snapshot of data (e.g. a savegame) quickly, which is then
+ * copied into the real target file system with 'copy_to()' - possibly on
+ * another thread, since the snapshot does not reference any game state.
+ *
+ * Sub file systems share their contents with the file system they were made from.
+ * Not thread-safe.
+ */
+class MemoryFilesystem : public FileSystem {
+public:
+	MemoryFilesystem();
+
+	FilenameSet list_directory(const std::string& path) const override;
+
+	bool is_writable() const override;
+	bool is_directory(const std::string& path) override;
+	bool file_exists(const std::string& path) const override;
+
+	void* load(const std::string& fname, size_t& length) override;
+
+	void write(const std::string& fname, void const* data, int32_t length) override;
+	void ensure_directory_exists(const std::string& fs_dirname) override;
+	void make_directory(const std::string& fs_dirname) override;
+
+	StreamRead* open_stream_read(const std::string& fname) override;
+	StreamWrite* open_stream_write(const std::string& fname) override;
+
+	FileSystem* make_sub_file_system(const std::string& fs_dirname) override;
+	FileSystem* create_sub_file_system(const std::string& fs_dirname, Type) override;
+	void fs_unlink(const std::string& fs_filename) override;
+	void fs_rename(const std::string&, const std::string&) override;
+
+	unsigned long long disk_space() override;
+
+	std::string get_basename() override;
+
+	/// Writes all directories and files of this file system into 'target'.
+	void copy_to(FileSystem& target) const;
+
+	/// The number of bytes in all files of this file system.
+	size_t size() const;
+
+private:
+	struct Contents {
+		// Keys are paths relative to the root, without a leading or trailing '/'.
+		std::map<std::string, std::string> files;
+		std::set<std::string> directories;
+	};
+
+	class MemoryStreamWrite;
+
+	MemoryFilesystem(const std::shared_ptr<Contents>& contents, const std::string& basedir);
+
+	// Converts 'path' to a key into 'contents_'.
+	std::string full_path(const std::string& path) const;
+
+	// Inserts 'full_path' and all its parents into 'contents_->directories'.
+	void add_directories(const std::string& full_path);
+
+	std::shared_ptr<Contents> contents_;
+	std::string basedir_;
+};
+
+#endif  // end of include guard: WL_IO_FILESYSTEM_MEMORY_FILESYSTEM_H
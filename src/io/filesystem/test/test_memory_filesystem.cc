@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "io/filesystem/memory_filesystem.h"
+
+// BOOST_CHECK_EQUAL generates an old-style cast usage warning, so ignore
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+namespace {
+std::string load_string(FileSystem& fs, const std::string& fname) {
+	size_t length;
+	void* data = fs.load(fname, length);
+	const std::string result(static_cast<const char*>(data), length);
+	free(data);
+	return result;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MemoryFilesystemTests)
+
+BOOST_AUTO_TEST_CASE(write_and_load) {
+	MemoryFilesystem fs;
+	fs.write("binary/heights", "abc", 3);
+	BOOST_CHECK(fs.file_exists("binary/heights"));
+	BOOST_CHECK(fs.is_directory("binary"));
+	BOOST_CHECK(!fs.is_directory("binary/heights"));
+	BOOST_CHECK_EQUAL(load_string(fs, "binary/heights"), "abc");
+	BOOST_CHECK_EQUAL(load_string(fs, "./binary/../binary/heights"), "abc");
+
+	fs.write("binary/heights", "de", 2);
+	BOOST_CHECK_EQUAL(load_string(fs, "binary/heights"), "de");
+	BOOST_CHECK_EQUAL(fs.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(sub_file_systems) {
+	MemoryFilesystem fs;
+	std::unique_ptr<FileSystem> map_fs(fs.create_sub_file_system("map", FileSystem::DIR));
+	map_fs->write("elemental", "x", 1);
+	map_fs->ensure_directory_exists("scripting");
+	BOOST_CHECK(fs.file_exists("map/elemental"));
+
+	const FilenameSet root = fs.list_directory("");
+	BOOST_CHECK_EQUAL(root.size(), 1);
+	BOOST_CHECK(root.count("map") == 1);
+
+	const FilenameSet map = map_fs->list_directory("");
+	BOOST_CHECK_EQUAL(map.size(), 2);
+	BOOST_CHECK(map.count("elemental") == 1);
+	BOOST_CHECK(map.count("scripting") == 1);
+
+	map_fs->fs_unlink("scripting");
+	BOOST_CHECK(!fs.file_exists("map/scripting"));
+}
+
+BOOST_AUTO_TEST_CASE(copy_to) {
+	MemoryFilesystem source;
+	source.write("preload", "p", 1);
+	source.write("map/binary/heights", "hh", 2);
+
+	MemoryFilesystem target;
+	source.copy_to(target);
+	BOOST_CHECK(target.is_directory("map/binary"));
+	BOOST_CHECK_EQUAL(load_string(target, "preload"), "p");
+	BOOST_CHECK_EQUAL(load_string(target, "map/binary/heights"), "hh");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
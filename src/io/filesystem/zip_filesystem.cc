@@ -25,10 +25,12 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <string>
 
 #include <boost/format.hpp>
 
+#include "base/parallel.h"
 #include "base/wexception.h"
 #include "io/filesystem/filesystem_exceptions.h"
 #include "io/filesystem/zip_exceptions.h"
@@ -48,6 +50,7 @@ ZipFilesystem::ZipFile::~ZipFile() {
 }
 
 void ZipFilesystem::ZipFile::close() {
+	finish_prefetching();
 	if (state_ == State::kZipping) {
 		zipClose(write_handle_, nullptr);
 	} else if (state_ == State::kUnzipping) {
@@ -81,30 +84,56 @@ void ZipFilesystem::ZipFile::open_for_unzip() {
 	if (!read_handle_)
 		throw FileTypeError("ZipFilesystem::open_for_unzip", path_, "not a .zip file");
 
+	// Read the whole central directory once, so that lookups don't need to walk it again.
+	std::vector<std::pair<std::string, Entry>> central_directory;
 	std::string first_entry;
 	size_t longest_prefix = 0;
 	unz_file_info file_info;
 	char filename_inzip[256];
 	for (;;) {
-		unzGetCurrentFileInfo(
-		   read_handle_, &file_info, filename_inzip, sizeof(filename_inzip), nullptr, 0, nullptr, 0);
+		// Stop at corrupt entries
+		if (unzGetCurrentFileInfo(read_handle_, &file_info, filename_inzip, sizeof(filename_inzip),
+		                          nullptr, 0, nullptr, 0) != UNZ_OK) {
+			break;
+		}
+		const std::string entry = filename_inzip;
 		if (first_entry.empty()) {
-			first_entry = filename_inzip;
+			first_entry = entry;
 			longest_prefix = first_entry.size();
 		} else {
-			const std::string entry = filename_inzip;
 			size_t pos = 0;
 			while (pos < longest_prefix && pos < entry.size() && first_entry[pos] == entry[pos]) {
 				++pos;
 			}
 			longest_prefix = pos;
 		}
+		central_directory.push_back(std::make_pair(entry, Entry()));
+		Entry& index_entry = central_directory.back().second;
+		unzGetFilePos(read_handle_, &index_entry.position);
+		index_entry.uncompressed_size = file_info.uncompressed_size;
+		index_entry.is_directory = !entry.empty() && *entry.rbegin() == '/';
 
 		if (unzGoToNextFile(read_handle_) == UNZ_END_OF_LIST_OF_FILE)
 			break;
 	}
 	common_prefix_ = first_entry.substr(0, longest_prefix);
 
+	entries_.clear();
+	files_by_directory_.clear();
+	for (const auto& item : central_directory) {
+		std::string complete_filename = strip_basename(item.first);
+		const std::string filename = fs_filename(complete_filename.c_str());
+		if (!filename.empty()) {
+			const std::string dirname =
+			   complete_filename.substr(0, complete_filename.size() - filename.size());
+			files_by_directory_[dirname].push_back(complete_filename);
+		}
+		if (!complete_filename.empty() && *complete_filename.rbegin() == '/') {
+			complete_filename.resize(complete_filename.size() - 1);
+		}
+		entries_.insert(std::make_pair(complete_filename, item.second));
+	}
+
 	state_ = State::kUnzipping;
 }
 
@@ -122,6 +151,146 @@ const unzFile& ZipFilesystem::ZipFile::read_handle() {
 	return read_handle_;
 }
 
+const unzFile& ZipFilesystem::ZipFile::read_handle(const Entry& entry) {
+	open_for_unzip();
+	unzGoToFilePos(read_handle_, &entry.position);
+	return read_handle_;
+}
+
+bool ZipFilesystem::ZipFile::find_entry(const std::string& path, Entry* entry) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	open_for_unzip();
+	const auto it = entries_.find(path);
+	if (it == entries_.end()) {
+		return false;
+	}
+	*entry = it->second;
+	return true;
+}
+
+const std::map<std::string, std::vector<std::string>>&
+ZipFilesystem::ZipFile::files_by_directory() {
+	std::lock_guard<std::mutex> lock(mutex_);
+	open_for_unzip();
+	return files_by_directory_;
+}
+
+void* ZipFilesystem::ZipFile::load(const std::string& path, const Entry& entry, size_t* length) {
+	std::future<LoadedFile> prefetched;
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		const auto it = prefetched_.find(path);
+		if (it != prefetched_.end()) {
+			prefetched = std::move(it->second);
+			prefetched_.erase(it);
+		}
+	}
+	if (prefetched.valid()) {
+		try {
+			const LoadedFile file = prefetched.get();
+			*length = file.length;
+			return file.data;
+		} catch (...) {
+			// Try again below, so that the error is reported from this thread.
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(mutex_);
+	open_for_unzip();
+	unzGoToFilePos(read_handle_, &entry.position);
+	const LoadedFile file = inflate(read_handle_, path, entry);
+	*length = file.length;
+	return file.data;
+}
+
+void ZipFilesystem::ZipFile::prefetch(const std::vector<std::pair<std::string, Entry>>& files) {
+	std::lock_guard<std::mutex> lock(mutex_);
+	open_for_unzip();
+
+	// Each thread works through every nth file, so that the files are ready roughly in the order
+	// in which they were requested.
+	const size_t nr_threads = std::min<size_t>(std::min(4U, nr_worker_threads()), files.size());
+	std::vector<std::vector<PrefetchJob>> jobs(nr_threads);
+	size_t next_thread = 0;
+	for (const auto& file : files) {
+		if (prefetched_.count(file.first)) {
+			continue;
+		}
+		PrefetchJob job{file.first, file.second, std::promise<LoadedFile>()};
+		prefetched_.insert(std::make_pair(file.first, job.result.get_future()));
+		jobs[next_thread].push_back(std::move(job));
+		next_thread = (next_thread + 1) % nr_threads;
+	}
+	for (std::vector<PrefetchJob>& thread_jobs : jobs) {
+		if (!thread_jobs.empty()) {
+			prefetch_threads_.push_back(
+			   std::thread(&ZipFile::prefetch_jobs, this, std::move(thread_jobs)));
+		}
+	}
+}
+
+void ZipFilesystem::ZipFile::prefetch_jobs(std::vector<PrefetchJob> jobs) const {
+	unzFile handle = unzOpen(path_.c_str());
+	for (PrefetchJob& job : jobs) {
+		try {
+			if (!handle) {
+				throw FileTypeError("ZipFilesystem::prefetch", path_, "not a .zip file");
+			}
+			unzGoToFilePos(handle, &job.entry.position);
+			job.result.set_value(inflate(handle, job.path, job.entry));
+		} catch (...) {
+			job.result.set_exception(std::current_exception());
+		}
+	}
+	if (handle) {
+		unzClose(handle);
+	}
+}
+
+void ZipFilesystem::ZipFile::finish_prefetching() {
+	for (std::thread& thread : prefetch_threads_) {
+		thread.join();
+	}
+	prefetch_threads_.clear();
+	for (auto& file : prefetched_) {
+		try {
+			free(file.second.get().data);
+		} catch (...) {
+			// Nobody wanted this file anyway
+		}
+	}
+	prefetched_.clear();
+}
+
+ZipFilesystem::ZipFile::LoadedFile ZipFilesystem::ZipFile::inflate(const unzFile& handle,
+                                                                   const std::string& path,
+                                                                   const Entry& entry) const {
+	// The central directory tells us the size, so we can inflate straight into the result.
+	const size_t totallen = entry.uncompressed_size;
+	void* const result = malloc(totallen + 1);
+	if (!result)
+		throw std::bad_alloc();
+
+	unzOpenCurrentFile(handle);
+	for (size_t offset = 0; offset < totallen;) {
+		const int32_t len = unzReadCurrentFile(
+		   handle, static_cast<uint8_t*>(result) + offset,
+		   std::min<size_t>(totallen - offset, std::numeric_limits<int32_t>::max()));
+		if (len <= 0) {
+			unzCloseCurrentFile(handle);
+			free(result);
+			const std::string errormessage =
+			   len < 0 ? (boost::format("read error %i") % len).str() : "unexpected end of file";
+			throw ZipOperationError("ZipFilesystem::load", path, path_, errormessage.c_str());
+		}
+		offset += len;
+	}
+	unzCloseCurrentFile(handle);
+
+	static_cast<uint8_t*>(result)[totallen] = 0;
+	return LoadedFile{result, totallen};
+}
+
 const std::string& ZipFilesystem::ZipFile::path() const {
 	return path_;
 }
@@ -166,78 +335,59 @@ FilenameSet ZipFilesystem::list_directory(const std::string& path_in) const {
 	if (*path.begin() == '/')
 		path = path.substr(1);
 
-	unzCloseCurrentFile(zip_file_->read_handle());
-	unzGoToFirstFile(zip_file_->read_handle());
-
-	unz_file_info file_info;
-	char filename_inzip[256];
 	std::set<std::string> results;
-	for (;;) {
-		unzGetCurrentFileInfo(zip_file_->read_handle(), &file_info, filename_inzip,
-		                      sizeof(filename_inzip), nullptr, 0, nullptr, 0);
-
-		std::string complete_filename = zip_file_->strip_basename(filename_inzip);
-		std::string filename = fs_filename(complete_filename.c_str());
-		std::string filepath =
-		   complete_filename.substr(0, complete_filename.size() - filename.size());
-
-		//  TODO(unknown): Something strange is going on with regard to the leading slash!
-		//  This is just an ugly workaround and does not solve the real
-		//  problem (which remains undiscovered)
-		if (('/' + path == filepath || path == filepath || path.length() == 1) && filename.size())
+	const auto insert_files = [this, &results](const std::vector<std::string>& files) {
+		for (const std::string& complete_filename : files) {
 			results.insert(complete_filename.substr(basedir_in_zip_file_.size()));
-
-		if (unzGoToNextFile(zip_file_->read_handle()) == UNZ_END_OF_LIST_OF_FILE)
-			break;
+		}
+	};
+	//  TODO(unknown): Something strange is going on with regard to the leading slash!
+	//  This is just an ugly workaround and does not solve the real
+	//  problem (which remains undiscovered)
+	const std::map<std::string, std::vector<std::string>>& files_by_directory =
+	   zip_file_->files_by_directory();
+	if (path.length() == 1) {
+		for (const auto& directory : files_by_directory) {
+			insert_files(directory.second);
+		}
+	} else {
+		for (const std::string& filepath : {path, '/' + path}) {
+			const auto it = files_by_directory.find(filepath);
+			if (it != files_by_directory.end()) {
+				insert_files(it->second);
+			}
+		}
 	}
 	return results;
 }
 
-/**
- * Returns true if the given file exists, and false if it doesn't.
- * Also returns false if the pathname is invalid
- */
-bool ZipFilesystem::file_exists(const std::string& path) const {
-	try {
-		unzGoToFirstFile(zip_file_->read_handle());
-	} catch (...) {
-		// The zip file could not be opened. I guess this means 'path' does not
-		// exist.
-		return false;
-	}
-	unz_file_info file_info;
-	char filename_inzip[256];
-	memset(filename_inzip, ' ', 256);
-
+std::string ZipFilesystem::path_in_zip_file(const std::string& path) const {
 	std::string path_in = basedir_in_zip_file_ + "/" + path;
 
 	if (*path_in.begin() == '/')
 		path_in = path_in.substr(1);
 
 	assert(path_in.size());
+	return path_in;
+}
 
-	for (;;) {
-		const int32_t success =
-		   unzGetCurrentFileInfo(zip_file_->read_handle(), &file_info, filename_inzip,
-		                         sizeof(filename_inzip), nullptr, 0, nullptr, 0);
-
-		// Handle corrupt files
-		if (success != UNZ_OK) {
-			return false;
-		}
-
-		std::string complete_filename = zip_file_->strip_basename(filename_inzip);
-
-		if (*complete_filename.rbegin() == '/')
-			complete_filename.resize(complete_filename.size() - 1);
-
-		if (path_in == complete_filename)
-			return true;
-
-		if (unzGoToNextFile(zip_file_->read_handle()) == UNZ_END_OF_LIST_OF_FILE)
-			break;
+bool ZipFilesystem::find_entry(const std::string& path, ZipFile::Entry* entry) const {
+	try {
+		return zip_file_->find_entry(path_in_zip_file(path), entry);
+	} catch (...) {
+		// The zip file could not be opened. I guess this means 'path' does not
+		// exist.
+		return false;
 	}
-	return false;
+}
+
+/**
+ * Returns true if the given file exists, and false if it doesn't.
+ * Also returns false if the pathname is invalid
+ */
+bool ZipFilesystem::file_exists(const std::string& path) const {
+	ZipFile::Entry entry;
+	return find_entry(path, &entry);
 }
 
 /**
@@ -245,17 +395,8 @@ bool ZipFilesystem::file_exists(const std::string& path) const {
  * Also returns false if the pathname is invalid
  */
 bool ZipFilesystem::is_directory(const std::string& path) {
-
-	if (!file_exists(path))
-		return false;
-
-	unz_file_info file_info;
-	char filename_inzip[256];
-
-	unzGetCurrentFileInfo(zip_file_->read_handle(), &file_info, filename_inzip,
-	                      sizeof(filename_inzip), nullptr, 0, nullptr, 0);
-
-	return filename_inzip[strlen(filename_inzip) - 1] == '/';
+	ZipFile::Entry entry;
+	return find_entry(path, &entry) && entry.is_directory;
 }
 
 /**
@@ -374,39 +515,23 @@ void ZipFilesystem::make_directory(const std::string& dirname) {
  * \throw FileNotFoundError if the file couldn't be opened.
  */
 void* ZipFilesystem::load(const std::string& fname, size_t& length) {
-	if (!file_exists(fname.c_str()) || is_directory(fname.c_str()))
+	ZipFile::Entry entry;
+	if (!find_entry(fname, &entry) || entry.is_directory)
 		throw ZipOperationError(
 		   "ZipFilesystem::load", fname, zip_file_->path(), "could not open file from zipfile");
 
-	char buffer[1024];
-	size_t totallen = 0;
-	unzOpenCurrentFile(zip_file_->read_handle());
-	for (;;) {
-		const int32_t len = unzReadCurrentFile(zip_file_->read_handle(), buffer, sizeof(buffer));
-		if (len == 0)
-			break;
-		if (len < 0) {
-			unzCloseCurrentFile(zip_file_->read_handle());
-			const std::string errormessage = (boost::format("read error %i") % len).str();
-			throw ZipOperationError(
-			   "ZipFilesystem::load", fname, zip_file_->path(), errormessage.c_str());
-		}
+	return zip_file_->load(path_in_zip_file(fname), entry, &length);
+}
 
-		totallen += len;
+void ZipFilesystem::prefetch(const std::vector<std::string>& fnames) {
+	std::vector<std::pair<std::string, ZipFile::Entry>> files;
+	for (const std::string& fname : fnames) {
+		ZipFile::Entry entry;
+		if (find_entry(fname, &entry) && !entry.is_directory) {
+			files.push_back(std::make_pair(path_in_zip_file(fname), entry));
+		}
 	}
-	unzCloseCurrentFile(zip_file_->read_handle());
-
-	void* const result = malloc(totallen + 1);
-	if (!result)
-		throw std::bad_alloc();
-	unzOpenCurrentFile(zip_file_->read_handle());
-	unzReadCurrentFile(zip_file_->read_handle(), result, totallen);
-	unzCloseCurrentFile(zip_file_->read_handle());
-
-	static_cast<uint8_t*>(result)[totallen] = 0;
-	length = totallen;
-
-	return result;
+	zip_file_->prefetch(files);
 }
 
 /**
@@ -452,12 +577,13 @@ void ZipFilesystem::write(const std::string& fname, void const* const data, int3
 }
 
 StreamRead* ZipFilesystem::open_stream_read(const std::string& fname) {
-	if (!file_exists(fname.c_str()) || is_directory(fname.c_str()))
+	ZipFile::Entry entry;
+	if (!find_entry(fname, &entry) || entry.is_directory)
 		throw ZipOperationError(
 		   "ZipFilesystem::load", fname, zip_file_->path(), "could not open file from zipfile");
 
 	int32_t method;
-	int result = unzOpenCurrentFile3(zip_file_->read_handle(), &method, nullptr, 1, nullptr);
+	int result = unzOpenCurrentFile3(zip_file_->read_handle(entry), &method, nullptr, 1, nullptr);
 	switch (result) {
 	case ZIP_OK:
 		break;
@@ -21,8 +21,15 @@
 #define WL_IO_FILESYSTEM_ZIP_FILESYSTEM_H
 
 #include <cstring>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base/macros.h"
 #include "io/filesystem/filesystem.h"
@@ -44,6 +51,7 @@ public:
 	bool file_exists(const std::string& path) const override;
 
 	void* load(const std::string& fname, size_t& length) override;
+	void prefetch(const std::vector<std::string>& fnames) override;
 
 	void write(const std::string& fname, void const* data, int32_t length) override;
 	void ensure_directory_exists(const std::string& fs_dirname) override;
@@ -70,8 +78,18 @@ private:
 	// state, which is represented in this struct. This is usually
 	// shared between the root file system, plus every filesystem generated
 	// through 'make_sub_file_system'.
+	//
+	// Looking up entries and loading files is thread-safe, everything else
+	// (writing, streams) is not.
 	class ZipFile {
 	public:
+		// An entry of the zip file's central directory.
+		struct Entry {
+			unz_file_pos position;
+			uLong uncompressed_size;
+			bool is_directory;
+		};
+
 		explicit ZipFile(const std::string& zipfile);
 
 		// Calls 'close()'.
@@ -92,7 +110,46 @@ private:
 		// minizip handle.
 		const unzFile& read_handle();
 
+		// Like read_handle(), but also makes 'entry' the current file.
+		const unzFile& read_handle(const Entry& entry);
+
+		// Looks up 'path' (relative, without a trailing '/') in the central directory.
+		// Returns false if there is no such entry.
+		bool find_entry(const std::string& path, Entry* entry);
+
+		// The relative paths of all files (not directories) in the zip file, grouped
+		// by their directory part.
+		const std::map<std::string, std::vector<std::string>>& files_by_directory();
+
+		// Inflates the file 'path' (relative) with the given entry into memory
+		// allocated with malloc(), followed by a zero byte. Picks up the result of
+		// prefetch() if there is one.
+		void* load(const std::string& path, const Entry& entry, size_t* length);
+
+		// Starts inflating the given files (relative paths with their entries) on
+		// background threads, each of which reads the zip file through its own handle.
+		void prefetch(const std::vector<std::pair<std::string, Entry>>& files);
+
 	private:
+		struct LoadedFile {
+			void* data;
+			size_t length;
+		};
+		struct PrefetchJob {
+			std::string path;
+			Entry entry;
+			std::promise<LoadedFile> result;
+		};
+
+		// Inflates 'entry' using 'handle', which may be any handle of this zip file.
+		LoadedFile inflate(const unzFile& handle, const std::string& path, const Entry& entry) const;
+
+		// Runs on a prefetch thread.
+		void prefetch_jobs(std::vector<PrefetchJob> jobs) const;
+
+		// Waits for the prefetch threads and frees everything that was not loaded.
+		void finish_prefetching();
+
 		// Closes 'path_' and reopens it for unzipping (read).
 		void open_for_unzip();
 
@@ -118,6 +175,22 @@ private:
 		// File handles for zipping and unzipping.
 		zipFile write_handle_;
 		unzFile read_handle_;
+
+		// Index of the central directory, rebuilt whenever the file is opened for
+		// unzipping. The keys are relative paths without a trailing '/'. If a path
+		// occurs several times, the first entry wins.
+		std::unordered_map<std::string, Entry> entries_;
+
+		// The relative paths of all files (not directories), grouped by their
+		// directory part.
+		std::map<std::string, std::vector<std::string>> files_by_directory_;
+
+		// Files that are being inflated in the background, by relative path.
+		std::unordered_map<std::string, std::future<LoadedFile>> prefetched_;
+		std::vector<std::thread> prefetch_threads_;
+
+		// Protects all of the above
+		std::mutex mutex_;
 	};
 
 	struct ZipStreamRead : StreamRead {
@@ -139,6 +212,14 @@ private:
 		std::shared_ptr<ZipFile> zip_file_;
 	};
 
+	// Converts 'path', which is relative to our base directory, into a path
+	// relative to the zip file.
+	std::string path_in_zip_file(const std::string& path) const;
+
+	// Looks up 'path', which is relative to our base directory, in the zip file.
+	// Returns false if it does not exist or the zip file can't be opened.
+	bool find_entry(const std::string& path, ZipFile::Entry* entry) const;
+
 	// Used for creating sub filesystems.
 	ZipFilesystem(const std::shared_ptr<ZipFile>& shared_data,
 	              const std::string& basedir_in_zip_file);
@@ -19,7 +19,11 @@
 
 #include "logic/cmd_queue.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "base/macros.h"
+#include "base/size_class_pool.h"
 #include "base/wexception.h"
 #include "io/fileread.h"
 #include "io/filewrite.h"
@@ -33,6 +37,22 @@
 
 namespace Widelands {
 
+namespace {
+
+constexpr uint32_t kWheelMask = kCommandQueueWheelSize - 1;
+
+uint32_t block_of(uint32_t const time) {
+	return time >> kCommandQueueWheelBits;
+}
+
+// Never destroyed, because commands can be deleted during static destruction
+SizeClassPool& command_pool() {
+	static SizeClassPool* pool = new SizeClassPool();
+	return *pool;
+}
+
+}  // namespace
+
 //
 // class Cmd_Queue
 //
@@ -40,13 +60,25 @@ CmdQueue::CmdQueue(Game& game)
    : game_(game),
      nextserial_(0),
      ncmds_(0),
-     cmds_(kCommandQueueBucketSize, std::priority_queue<CmdItem>()) {
+     current_time_(0),
+     near_wheel_(kCommandQueueWheelSize),
+     far_wheel_(kCommandQueueWheelSize),
+     nr_executed_(0),
+     profiling_(false) {
 }
 
 CmdQueue::~CmdQueue() {
 	flush();
 }
 
+void* CmdQueue::allocate_command(size_t const size) {
+	return command_pool().allocate(size);
+}
+
+void CmdQueue::deallocate_command(void* const ptr, size_t const size) {
+	command_pool().deallocate(ptr, size);
+}
+
 /*
  * flushs all commands from the queue. Needed for
  * game loading (while in game)
@@ -54,17 +86,12 @@ CmdQueue::~CmdQueue() {
 // TODO(unknown): ...but game loading while in game is not possible!
 // Note: Order of destruction of Items is not guaranteed
 void CmdQueue::flush() {
-	uint32_t cbucket = 0;
-	while (ncmds_ && cbucket < kCommandQueueBucketSize) {
-		std::priority_queue<CmdItem>& current_cmds = cmds_[cbucket];
-
-		while (!current_cmds.empty()) {
-			Command* cmd = current_cmds.top().cmd;
-			current_cmds.pop();
-			delete cmd;
-			--ncmds_;
-		}
-		++cbucket;
+	std::vector<CmdItem> items;
+	collect_items(&items);
+	clear_wheels();
+	for (const CmdItem& item : items) {
+		delete item.cmd;
+		--ncmds_;
 	}
 	assert(ncmds_ == 0);
 }
@@ -78,51 +105,150 @@ void CmdQueue::enqueue(Command* const cmd) {
 	CmdItem ci;
 
 	ci.cmd = cmd;
-	if (upcast(PlayerCommand, plcmd, cmd)) {
-		ci.category = cat_playercommand;
-		ci.serial = plcmd->cmdserial();
-	} else if (dynamic_cast<GameLogicCommand*>(cmd)) {
-		ci.category = cat_gamelogic;
+	ci.duetime = cmd->duetime();
+	ci.category = cmd->category();
+	switch (ci.category) {
+	case CommandCategory::kPlayerCommand:
+		ci.serial = static_cast<PlayerCommand*>(cmd)->cmdserial();
+		break;
+	case CommandCategory::kGameLogic:
 		ci.serial = nextserial_++;
-	} else {
+		break;
+	case CommandCategory::kNonGameLogic:
 		// the order of non-gamelogic commands matters only with respect to
 		// gamelogic commands; the order of non-gamelogic commands wrt other
 		// non-gamelogic commands shouldn't matter, so we can assign a
 		// constant serial number.
-		ci.category = cat_nongamelogic;
 		ci.serial = 0;
+		break;
 	}
 
-	cmds_[cmd->duetime() % kCommandQueueBucketSize].push(ci);
+	insert(ci);
 	++ncmds_;
 }
 
+void CmdQueue::insert(const CmdItem& item) {
+	if (item.duetime < current_time_) {
+		// Overdue commands are run with the next bucket, before the ones that are
+		// due then. This also happens while the game time is changed from
+		// outside, until rebase() sorts them into the right place.
+		std::vector<CmdItem>& bucket = near_wheel_[current_time_ & kWheelMask];
+		bucket.push_back(item);
+		std::push_heap(bucket.begin(), bucket.end());
+		return;
+	}
+	const uint32_t block = block_of(item.duetime);
+	const uint32_t blocks_ahead = block - block_of(current_time_);
+	if (blocks_ahead == 0) {
+		std::vector<CmdItem>& bucket = near_wheel_[item.duetime & kWheelMask];
+		bucket.push_back(item);
+		std::push_heap(bucket.begin(), bucket.end());
+	} else if (blocks_ahead < kCommandQueueWheelSize) {
+		far_wheel_[block & kWheelMask].push_back(item);
+	} else {
+		distant_cmds_.push(item);
+	}
+}
+
+void CmdQueue::advance() {
+	++current_time_;
+	if (current_time_ & kWheelMask) {
+		return;
+	}
+
+	// We have entered a new block. Its commands move to the near wheel, and the
+	// far wheel now reaches one block further.
+	const uint32_t block = block_of(current_time_);
+	std::vector<CmdItem> cascading;
+	cascading.swap(far_wheel_[block & kWheelMask]);
+	for (const CmdItem& item : cascading) {
+		insert(item);
+	}
+	// Written without a subtraction, so that an overdue command cannot wrap around
+	while (!distant_cmds_.empty() &&
+	       block_of(distant_cmds_.top().duetime) < block + kCommandQueueWheelSize) {
+		insert(distant_cmds_.top());
+		distant_cmds_.pop();
+	}
+}
+
+void CmdQueue::rebase(uint32_t const time) {
+	std::vector<CmdItem> items;
+	collect_items(&items);
+	clear_wheels();
+	current_time_ = time;
+	for (const CmdItem& item : items) {
+		insert(item);
+	}
+}
+
+void CmdQueue::collect_items(std::vector<CmdItem>* items) const {
+	items->reserve(items->size() + ncmds_);
+	for (const std::vector<CmdItem>& bucket : near_wheel_) {
+		items->insert(items->end(), bucket.begin(), bucket.end());
+	}
+	for (const std::vector<CmdItem>& bucket : far_wheel_) {
+		items->insert(items->end(), bucket.begin(), bucket.end());
+	}
+	std::priority_queue<CmdItem> distant = distant_cmds_;
+	while (!distant.empty()) {
+		items->push_back(distant.top());
+		distant.pop();
+	}
+}
+
+void CmdQueue::clear_wheels() {
+	for (std::vector<CmdItem>& bucket : near_wheel_) {
+		bucket.clear();
+	}
+	for (std::vector<CmdItem>& bucket : far_wheel_) {
+		bucket.clear();
+	}
+	distant_cmds_ = std::priority_queue<CmdItem>();
+}
+
 void CmdQueue::run_queue(int32_t const interval, uint32_t& game_time_var) {
+	if (current_time_ != game_time_var) {
+		rebase(game_time_var);
+	}
+
 	uint32_t const final = game_time_var + interval;
 
 	while (game_time_var < final) {
-		std::priority_queue<CmdItem>& current_cmds = cmds_[game_time_var % kCommandQueueBucketSize];
+		std::vector<CmdItem>& current_cmds = near_wheel_[game_time_var & kWheelMask];
 
+		// Commands that are enqueued while we run this bucket and that are due
+		// right now are pushed onto the same heap, so they are run in order too.
 		while (!current_cmds.empty()) {
-			Command& c = *current_cmds.top().cmd;
-			if (game_time_var < c.duetime())
-				break;
-
-			current_cmds.pop();
+			std::pop_heap(current_cmds.begin(), current_cmds.end());
+			Command& c = *current_cmds.back().cmd;
+			current_cmds.pop_back();
 			--ncmds_;
-			assert(game_time_var == c.duetime());
+			assert(c.duetime() <= game_time_var);
 
-			if (dynamic_cast<GameLogicCommand*>(&c)) {
+			if (c.category() != CommandCategory::kNonGameLogic) {
 				StreamWrite& ss = game_.syncstream();
 				ss.unsigned_8(SyncEntry::kRunQueue);
 				ss.unsigned_32(c.duetime());
 				ss.unsigned_32(static_cast<uint32_t>(c.id()));
 			}
 
-			c.execute(game_);
+			if (profiling_) {
+				const auto start = std::chrono::steady_clock::now();
+				c.execute(game_);
+				CommandTypeStatistics& stats = profile_[c.id()];
+				++stats.count;
+				stats.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+				                        std::chrono::steady_clock::now() - start)
+				                        .count();
+			} else {
+				c.execute(game_);
+			}
+			++nr_executed_;
 
 			delete &c;
 		}
+		advance();
 		++game_time_var;
 	}
 
@@ -20,9 +20,10 @@
 #ifndef WL_LOGIC_CMD_QUEUE_H
 #define WL_LOGIC_CMD_QUEUE_H
 
+#include <map>
 #include <memory>
 #include <queue>
-#include <stdint.h>
+#include <vector>
 
 #include <stdint.h>
 
@@ -38,25 +39,40 @@ class Game;
 class MapObjectLoader;
 struct MapObjectSaver;
 
-constexpr uint32_t kCommandQueueBucketSize = 65536;  // Make this a power of two, so that % is fast
-
 // This is the command queue. It is fully widelands specific,
 // it needs to know nearly all modules.
 //
 // It used to be implemented as a priority_queue sorted by execution_time,
 // serial and type of commands. This proved to be a performance bottleneck on
-// big games. I then changed this to use a constant size hash_map[gametime] of
-// priority_queues. This allows for ~O(1) access by time and in my analyses,
-// practically all buckets were used, so there is not much memory overhead.
-// This removed the bottleneck for big games.
+// big games, so it was changed to a constant size vector[gametime % 65536] of
+// priority_queues. That still paid for a dynamic_cast per command on enqueue
+// and on execution, and far-future commands shared their buckets with the
+// current ones.
 //
-// I first tried with boost::unordered_map, but as expected, it grew beyond all
-// limits when accessed with gametime. Therefore I reverted back to a simple
-// vector.
-//
-// The price we pay is that when saving, we also have to traverse till we no
-// longer find any new command to write. This could theoretically take forever
-// but in my tests it was not noticeable.
+// Now it is a hierarchical timing wheel:
+//  - The near wheel has one bucket per millisecond of the current block of
+//    kCommandQueueWheelSize milliseconds. Each bucket is a binary heap, so
+//    that commands that are due at the same time are executed in a fixed
+//    order (category, then serial) on all systems.
+//  - The far wheel has one unsorted bucket per block for the next
+//    kCommandQueueWheelSize blocks (about 4.6 hours of gametime). When the
+//    game time enters a new block, its bucket is moved to the near wheel.
+//  - Everything beyond that waits in a priority_queue and is moved to the far
+//    wheel when its block comes into range.
+//  - Commands that are enqueued with a duetime in the past go into the
+//    current bucket, so they are run as soon as possible.
+// The category of a command is stored in the command itself, so no RTTI is
+// needed to sort or run it.
+
+constexpr uint32_t kCommandQueueWheelBits = 12;
+constexpr uint32_t kCommandQueueWheelSize = 1 << kCommandQueueWheelBits;
+
+/**
+ * Commands that are due at the same time are executed in the order of their category.
+ *
+ * The values are stored in savegames, so don't change them.
+ */
+enum class CommandCategory : int32_t { kNonGameLogic = 0, kGameLogic = 1, kPlayerCommand = 2 };
 
 /**
  * A command that is supposed to be executed at a certain gametime.
@@ -69,7 +85,9 @@ constexpr uint32_t kCommandQueueBucketSize = 65536;  // Make this a power of two
  * the same for all parallel simulation.
  */
 struct Command {
-	explicit Command(const uint32_t init_duetime) : duetime_(init_duetime) {
+	explicit Command(uint32_t init_duetime,
+	                 CommandCategory init_category = CommandCategory::kNonGameLogic)
+	   : duetime_(init_duetime), category_(init_category) {
 	}
 	virtual ~Command();
 
@@ -82,9 +100,13 @@ struct Command {
 	void set_duetime(uint32_t const t) {
 		duetime_ = t;
 	}
+	CommandCategory category() const {
+		return category_;
+	}
 
 private:
 	uint32_t duetime_;
+	CommandCategory category_;
 };
 
 /**
@@ -95,7 +117,9 @@ private:
  * for all instances of a game to ensure parallel simulation.
  */
 struct GameLogicCommand : public Command {
-	explicit GameLogicCommand(uint32_t const init_duetime) : Command(init_duetime) {
+	explicit GameLogicCommand(uint32_t init_duetime,
+	                          CommandCategory init_category = CommandCategory::kGameLogic)
+	   : Command(init_duetime, init_category) {
 	}
 
 	// Write these commands to a file (for savegames)
@@ -106,22 +130,23 @@ struct GameLogicCommand : public Command {
 class CmdQueue {
 	friend struct GameCmdQueuePacket;
 
-	enum { cat_nongamelogic = 0, cat_gamelogic, cat_playercommand };
-
 	struct CmdItem {
 		Command* cmd;
 
+		/// Copy of cmd->duetime(), so that sorting does not need to touch the command
+		uint32_t duetime;
+
 		/**
 		 * category and serial are used to sort commands such that
 		 * commands will be executed in the same order on all systems
 		 * independent of details of the priority_queue implementation.
 		 */
-		int32_t category;
+		CommandCategory category;
 		uint32_t serial;
 
 		bool operator<(const CmdItem& c) const {
-			if (cmd->duetime() != c.cmd->duetime())
-				return cmd->duetime() > c.cmd->duetime();
+			if (duetime != c.duetime)
+				return duetime > c.duetime;
 			else if (category != c.category)
 				return category > c.category;
 			else
@@ -130,6 +155,13 @@ class CmdQueue {
 	};
 
 public:
+	/// Execution statistics for one command type, see set_profiling()
+	struct CommandTypeStatistics {
+		uint64_t count = 0;
+		uint64_t nanoseconds = 0;
+	};
+	using Profile = std::map<QueueCommandTypes, CommandTypeStatistics>;
+
 	explicit CmdQueue(Game&);
 	~CmdQueue();
 
@@ -144,12 +176,57 @@ public:
 
 	void flush();  // delete all commands in the queue now
 
+	/// When enabled, run_queue() measures the time that every command takes
+	/// and sums it up per command type. Meant for benchmarks.
+	void set_profiling(bool enabled) {
+		profiling_ = enabled;
+	}
+	const Profile& profile() const {
+		return profile_;
+	}
+
+	/// Number of commands that have been run so far
+	uint64_t nr_executed_commands() const {
+		return nr_executed_;
+	}
+
+	/// Memory for command types that are scheduled very often (e.g. CmdAct)
+	/// comes from a free-list pool, see their operator new. Only to be used
+	/// from the logic thread.
+	static void* allocate_command(size_t size);
+	static void deallocate_command(void* ptr, size_t size);
+
 private:
+	/// Sorts the item into the wheel that it belongs to relative to current_time_
+	void insert(const CmdItem&);
+
+	/// Moves current_time_ forward by 1 ms and refills the near wheel when a new block starts
+	void advance();
+
+	/// Sets current_time_ to 'time' and sorts all commands into the wheels again.
+	/// Needed when the game time was changed from outside, e.g. when loading a game.
+	void rebase(uint32_t time);
+
+	/// Appends all queued commands in no particular order
+	void collect_items(std::vector<CmdItem>* items) const;
+
+	/// Empties the wheels without deleting the commands
+	void clear_wheels();
+
 	Game& game_;
 	uint32_t nextserial_;
 	uint32_t ncmds_;
-	using CommandsContainer = std::vector<std::priority_queue<CmdItem>>;
-	CommandsContainer cmds_;
+
+	/// The wheels are arranged around this time, which is the time of the next
+	/// bucket to be run.
+	uint32_t current_time_;
+	std::vector<std::vector<CmdItem>> near_wheel_;
+	std::vector<std::vector<CmdItem>> far_wheel_;
+	std::priority_queue<CmdItem> distant_cmds_;
+
+	uint64_t nr_executed_;
+	bool profiling_;
+	Profile profile_;
 };
 }  // namespace Widelands
 
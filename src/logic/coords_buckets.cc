@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "logic/coords_buckets.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "logic/map.h"
+
+namespace Widelands {
+
+constexpr int16_t CoordsBuckets::kBucketSize;
+
+void CoordsBuckets::add(const Map& map, const Coords& coords) {
+	if (buckets_.empty()) {
+		nr_columns_ = (map.get_width() + kBucketSize - 1) / kBucketSize;
+		nr_rows_ = (map.get_height() + kBucketSize - 1) / kBucketSize;
+		buckets_.resize(nr_columns_ * nr_rows_);
+	}
+	bucket(coords).push_back(coords);
+	++size_;
+}
+
+void CoordsBuckets::remove(const Coords& coords) {
+	assert(!buckets_.empty());
+	if (buckets_.empty()) {
+		return;
+	}
+	std::vector<Coords>& entries = bucket(coords);
+	const auto it = std::find(entries.begin(), entries.end(), coords);
+	assert(it != entries.end());
+	if (it != entries.end()) {
+		entries.erase(it);
+		--size_;
+	}
+}
+
+void CoordsBuckets::clear() {
+	buckets_.clear();
+	nr_columns_ = nr_rows_ = 0;
+	size_ = 0;
+}
+
+void CoordsBuckets::find(const Map& map,
+                         const Area<Coords>& area,
+                         std::vector<Coords>* result) const {
+	if (empty()) {
+		return;
+	}
+	// A single step changes each coordinate by at most 1, so everything within
+	// the radius is also within the square around the center.
+	const std::vector<uint16_t> columns =
+	   bucket_span(area.x, area.radius, map.get_width(), nr_columns_);
+	for (uint16_t row : bucket_span(area.y, area.radius, map.get_height(), nr_rows_)) {
+		for (uint16_t column : columns) {
+			for (const Coords& coords : buckets_[row * nr_columns_ + column]) {
+				if (map.calc_distance(area, coords) <= area.radius) {
+					result->push_back(coords);
+				}
+			}
+		}
+	}
+}
+
+std::vector<Coords>& CoordsBuckets::bucket(const Coords& coords) {
+	return buckets_[coords.y / kBucketSize * nr_columns_ + coords.x / kBucketSize];
+}
+
+// The buckets that cover [center - radius, center + radius] along an axis
+// that wraps around after 'length' nodes.
+std::vector<uint16_t> CoordsBuckets::bucket_span(int16_t const center,
+                                                 uint16_t const radius,
+                                                 int16_t const length,
+                                                 uint16_t const nr_buckets) const {
+	std::vector<uint16_t> result;
+	const int32_t first = ((center - radius) % length + length) % length;
+	const int32_t last = (center + radius) % length;
+	const int32_t first_bucket = first / kBucketSize;
+	const int32_t last_bucket = last / kBucketSize;
+	if (2 * radius + 1 >= length || (first > last && first_bucket <= last_bucket)) {
+		for (uint16_t i = 0; i < nr_buckets; ++i) {
+			result.push_back(i);
+		}
+	} else if (first <= last) {
+		for (int32_t i = first_bucket; i <= last_bucket; ++i) {
+			result.push_back(i);
+		}
+	} else {
+		for (int32_t i = first_bucket; i < nr_buckets; ++i) {
+			result.push_back(i);
+		}
+		for (int32_t i = 0; i <= last_bucket; ++i) {
+			result.push_back(i);
+		}
+	}
+	return result;
+}
+}  // namespace Widelands
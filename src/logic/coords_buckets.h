@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_LOGIC_COORDS_BUCKETS_H
+#define WL_LOGIC_COORDS_BUCKETS_H
+
+#include <vector>
+
+#include "logic/widelands_geometry.h"
+
+namespace Widelands {
+
+class Map;
+
+/**
+ * A set of locations on the map that is sorted into square buckets, so that
+ * the ones near a given location can be found without looking at all of
+ * them. Used e.g. by the Player to find its military sites near an enemy
+ * flag.
+ *
+ * The buckets are created with the first add(), so the map must have its
+ * final size by then.
+ */
+class CoordsBuckets {
+public:
+	void add(const Map& map, const Coords& coords);
+	/// 'coords' must have been added before. This is only checked in debug builds.
+	void remove(const Coords& coords);
+	void clear();
+
+	/// Appends all locations within the area to 'result'. The order only
+	/// depends on the order of the add() and remove() calls.
+	void find(const Map& map, const Area<Coords>& area, std::vector<Coords>* result) const;
+
+	bool empty() const {
+		return size_ == 0;
+	}
+
+private:
+	static constexpr int16_t kBucketSize = 16;
+
+	std::vector<Coords>& bucket(const Coords& coords);
+	std::vector<uint16_t>
+	bucket_span(int16_t center, uint16_t radius, int16_t length, uint16_t nr_buckets) const;
+
+	uint16_t nr_columns_ = 0;
+	uint16_t nr_rows_ = 0;
+	uint32_t size_ = 0;
+	std::vector<std::vector<Coords>> buckets_;
+};
+}  // namespace Widelands
+
+#endif  // end of include guard: WL_LOGIC_COORDS_BUCKETS_H
@@ -618,7 +618,7 @@ void EditorGameBase::change_field_owner(const FCoords& fc, PlayerNumber const ne
 		   NoteFieldPossession(fc, NoteFieldPossession::Ownership::LOST, get_player(old_owner)));
 	}
 
-	fc.field->set_owned_by(new_owner);
+	map_.set_owned_by(fc, new_owner);
 
 	// TODO(unknown): the player should do this when it gets the NoteFieldPossession.
 	// This means also sending a note when new_player = 0, i.e. the field is no
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_LOGIC_FIELD_COLUMNS_H
+#define WL_LOGIC_FIELD_COLUMNS_H
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "logic/field.h"
+#include "logic/nodecaps.h"
+#include "logic/widelands.h"
+#include "logic/widelands_geometry.h"
+
+namespace Widelands {
+
+/**
+ * The node attributes that scans over many nodes need most, each in its own
+ * contiguous array (structure of arrays), indexed by MapIndex.
+ *
+ * A Field mixes pointers with bytes, so a scan that only looks at e.g. the
+ * owner or the caps still pulls whole Fields into the cache. Such scans can
+ * read the columns instead.
+ *
+ * The Fields remain authoritative. The Map keeps the columns up to date:
+ * they are refreshed by recalc_nodecaps_pass1(), which has to run for every
+ * node whose height, terrain or immovable changes, and directly when caps,
+ * resources or owners change.
+ *
+ * Alongside the owner column, the number of nodes owned by each player is
+ * kept, so that the land size statistics need not scan the map.
+ */
+class FieldColumns {
+public:
+	using Predicate = std::function<bool(const FieldColumns&, MapIndex)>;
+
+	void resize(MapIndex const nr_fields) {
+		owners_.assign(nr_fields, neutral());
+		land_sizes_.assign(std::numeric_limits<PlayerNumber>::max() + 1, 0);
+		land_sizes_[neutral()] = nr_fields;
+		caps_.assign(nr_fields, CAPS_NONE);
+		maxcaps_.assign(nr_fields, CAPS_NONE);
+		heights_.assign(nr_fields, 0);
+		terrains_.assign(nr_fields, Field::Terrains{INVALID_INDEX, INVALID_INDEX});
+		resources_.assign(nr_fields, INVALID_INDEX);
+		resource_amounts_.assign(nr_fields, 0);
+	}
+	void clear() {
+		resize(0);
+	}
+
+	/// Copies all attributes from the Field
+	void update(MapIndex const i, const Field& f) {
+		set_owner(i, f.get_owned_by());
+		caps_[i] = f.nodecaps();
+		maxcaps_[i] = f.maxcaps();
+		heights_[i] = f.get_height();
+		terrains_[i] = f.get_terrains();
+		resources_[i] = f.get_resources();
+		resource_amounts_[i] = f.get_resources_amount();
+	}
+	void update_caps(MapIndex const i, const Field& f) {
+		caps_[i] = f.nodecaps();
+		maxcaps_[i] = f.maxcaps();
+	}
+	void update_resources(MapIndex const i, const Field& f) {
+		resources_[i] = f.get_resources();
+		resource_amounts_[i] = f.get_resources_amount();
+	}
+	void set_owner(MapIndex const i, PlayerNumber const owner) {
+		--land_sizes_[owners_[i]];
+		owners_[i] = owner;
+		++land_sizes_[owner];
+	}
+
+	MapIndex size() const {
+		return owners_.size();
+	}
+
+	/// The number of nodes owned by 'player'
+	MapIndex land_size(PlayerNumber const player) const {
+		return land_sizes_[player];
+	}
+
+	// Same meaning as the Field functions with the same names
+	PlayerNumber get_owned_by(MapIndex const i) const {
+		return owners_[i];
+	}
+	NodeCaps nodecaps(MapIndex const i) const {
+		return static_cast<NodeCaps>(caps_[i]);
+	}
+	NodeCaps maxcaps(MapIndex const i) const {
+		return static_cast<NodeCaps>(maxcaps_[i]);
+	}
+	Field::Height get_height(MapIndex const i) const {
+		return heights_[i];
+	}
+	Field::Terrains get_terrains(MapIndex const i) const {
+		return terrains_[i];
+	}
+	DescriptionIndex get_resources(MapIndex const i) const {
+		return resources_[i];
+	}
+	Field::ResourceAmount get_resources_amount(MapIndex const i) const {
+		return resource_amounts_[i];
+	}
+
+	// Whole columns, for linear scans
+	const std::vector<PlayerNumber>& owner_column() const {
+		return owners_;
+	}
+	const std::vector<uint8_t>& caps_column() const {
+		return caps_;
+	}
+	const std::vector<uint8_t>& maxcaps_column() const {
+		return maxcaps_;
+	}
+	const std::vector<Field::Height>& height_column() const {
+		return heights_;
+	}
+
+private:
+	std::vector<PlayerNumber> owners_;
+	std::vector<MapIndex> land_sizes_;  // Indexed by PlayerNumber
+	std::vector<uint8_t> caps_;
+	std::vector<uint8_t> maxcaps_;
+	std::vector<Field::Height> heights_;
+	std::vector<Field::Terrains> terrains_;
+	std::vector<DescriptionIndex> resources_;
+	std::vector<Field::ResourceAmount> resource_amounts_;
+};
+
+}  // namespace Widelands
+
+#endif  // end of include guard: WL_LOGIC_FIELD_COLUMNS_H
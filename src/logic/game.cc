@@ -75,6 +75,15 @@ namespace Widelands {
 /// Define this to get lots of debugging output concerned with syncs
 // #define SYNC_DEBUG
 
+namespace {
+// The loader UI is optional, headless games run without it
+void step_loader_ui(UI::ProgressWindow* loader_ui, const std::string& description) {
+	if (loader_ui) {
+		loader_ui->step(description);
+	}
+}
+}  // namespace
+
 Game::SyncWrapper::~SyncWrapper() {
 	if (dump_ != nullptr) {
 		if (!syncstreamsave_)
@@ -130,6 +139,8 @@ void Game::SyncWrapper::data(void const* const sync_data, size_t const size) {
 Game::Game()
    : EditorGameBase(new LuaGameInterface(this)),
      forester_cache_(),
+     sync_hash_type_(SyncHashType::kXxh64),
+     synchash_(sync_hash_type_),
      syncwrapper_(*this, synchash_),
      ctrl_(nullptr),
      writereplay_(true),
@@ -150,8 +161,8 @@ Game::~Game() {
 void Game::sync_reset() {
 	syncwrapper_.counter_ = 0;
 
-	synchash_.reset();
-	log("[sync] Reset\n");
+	synchash_.reset(sync_hash_type_);
+	log("[sync] Reset, using %s\n", sync_hash_type_ == SyncHashType::kMd5 ? "MD5" : "XXH64");
 }
 
 /**
@@ -270,25 +281,23 @@ bool Game::run_splayer_scenario_direct(const std::string& mapname,
  *
  */
 void Game::init_newgame(UI::ProgressWindow* loader_ui, const GameSettings& settings) {
-	assert(loader_ui != nullptr);
-
-	loader_ui->step(_("Preloading map"));
+	step_loader_ui(loader_ui, _("Preloading map"));
 
 	std::unique_ptr<MapLoader> maploader(mutable_map()->get_correct_loader(settings.mapfilename));
 	assert(maploader != nullptr);
 	maploader->preload_map(settings.scenario);
 
-	loader_ui->step(_("Loading world"));
+	step_loader_ui(loader_ui, _("Loading world"));
 	world();
 
-	loader_ui->step(_("Loading tribes"));
+	step_loader_ui(loader_ui, _("Loading tribes"));
 	tribes();
 
 	std::string const background = map().get_background();
-	if (!background.empty()) {
+	if (loader_ui && !background.empty()) {
 		loader_ui->set_background(background);
 	}
-	loader_ui->step(_("Creating players"));
+	step_loader_ui(loader_ui, _("Creating players"));
 
 	std::vector<PlayerSettings> shared;
 	std::vector<uint8_t> shared_num;
@@ -316,14 +325,14 @@ void Game::init_newgame(UI::ProgressWindow* loader_ui, const GameSettings& setti
 		   ->add_further_starting_position(shared_num.at(n), shared.at(n).initialization_index);
 	}
 
-	loader_ui->step(_("Loading map…"));
+	step_loader_ui(loader_ui, _("Loading map…"));
 	maploader->load_map_complete(*this, settings.scenario ?
 	                                       Widelands::MapLoader::LoadType::kScenario :
 	                                       Widelands::MapLoader::LoadType::kGame);
 
 	// Check for win_conditions
 	if (!settings.scenario) {
-		loader_ui->step(_("Initializing game…"));
+		step_loader_ui(loader_ui, _("Initializing game…"));
 		if (settings.peaceful) {
 			for (uint32_t i = 1; i < settings.players.size(); ++i) {
 				if (Player* p1 = get_player(i)) {
@@ -358,9 +367,7 @@ void Game::init_newgame(UI::ProgressWindow* loader_ui, const GameSettings& setti
  * run<Returncode>() takes care about this difference.
  */
 void Game::init_savegame(UI::ProgressWindow* loader_ui, const GameSettings& settings) {
-	assert(loader_ui != nullptr);
-
-	loader_ui->step(_("Preloading map"));
+	step_loader_ui(loader_ui, _("Preloading map"));
 
 	try {
 		GameLoader gl(settings.mapfilename, *this);
@@ -372,8 +379,10 @@ void Game::init_savegame(UI::ProgressWindow* loader_ui, const GameSettings& sett
 			set_write_replay(false);
 		}
 		std::string background(gpdp.get_background());
-		loader_ui->set_background(background);
-		loader_ui->step(_("Loading…"));
+		if (loader_ui) {
+			loader_ui->set_background(background);
+		}
+		step_loader_ui(loader_ui, _("Loading…"));
 		gl.load_game(settings.multiplayer);
 		// Players might have selected a different AI type
 		for (uint8_t i = 0; i < settings.players.size(); ++i) {
@@ -441,7 +450,9 @@ bool Game::run_load_game(const std::string& filename, const std::string& script_
  */
 void Game::postload() {
 	EditorGameBase::postload();
-	get_ibase()->postload();
+	if (get_ibase()) {
+		get_ibase()->postload();
+	}
 }
 
 /**
@@ -468,15 +479,53 @@ bool Game::run(UI::ProgressWindow* loader_ui,
                const std::string& prefix_for_replays) {
 	assert(loader_ui != nullptr);
 
+	prepare_to_run(loader_ui, start_game_type, script_to_run, replay, prefix_for_replays);
+
+	load_graphics(*loader_ui);
+
+#ifdef _WIN32
+	//  Clear the event queue before starting game because we don't want
+	//  to handle events at game start that happened during loading procedure.
+	SDL_Event event;
+	while (SDL_PollEvent(&event))
+		;
+#endif
+
+	g_sh->change_music("ingame", 1000);
+
+	state_ = gs_running;
+
+	get_ibase()->run<UI::Panel::Returncodes>();
+
+	state_ = gs_ending;
+
+	g_sh->change_music("menu", 1000);
+
+	cleanup_objects();
+	set_ibase(nullptr);
+
+	state_ = gs_notrunning;
+
+	return true;
+}
+
+void Game::start_headless(StartGameType const start_game_type, const std::string& script_to_run) {
+	prepare_to_run(nullptr, start_game_type, script_to_run, false, "headless");
+	state_ = gs_running;
+}
+
+void Game::prepare_to_run(UI::ProgressWindow* loader_ui,
+                          StartGameType const start_game_type,
+                          const std::string& script_to_run,
+                          bool replay,
+                          const std::string& prefix_for_replays) {
 	replay_ = replay;
 	postload();
 
 	if (start_game_type != Loaded) {
 		PlayerNumber const nr_players = map().get_nrplayers();
 		if (start_game_type == NewNonScenario) {
-			if (loader_ui) {
-				loader_ui->step(_("Creating player infrastructure"));
-			}
+			step_loader_ui(loader_ui, _("Creating player infrastructure"));
 			iterate_players_existing(p, nr_players, *this, plr) {
 				plr->create_default_infrastructure();
 			}
@@ -552,33 +601,6 @@ bool Game::run(UI::ProgressWindow* loader_ui,
 	}
 
 	sync_reset();
-
-	load_graphics(*loader_ui);
-
-#ifdef _WIN32
-	//  Clear the event queue before starting game because we don't want
-	//  to handle events at game start that happened during loading procedure.
-	SDL_Event event;
-	while (SDL_PollEvent(&event))
-		;
-#endif
-
-	g_sh->change_music("ingame", 1000);
-
-	state_ = gs_running;
-
-	get_ibase()->run<UI::Panel::Returncodes>();
-
-	state_ = gs_ending;
-
-	g_sh->change_music("menu", 1000);
-
-	cleanup_objects();
-	set_ibase(nullptr);
-
-	state_ = gs_notrunning;
-
-	return true;
 }
 
 /**
@@ -689,10 +711,7 @@ void Game::report_desync(int32_t playernumber) {
  * \return the checksum
  */
 Md5Checksum Game::get_sync_hash() const {
-	MD5Checksum<StreamWrite> copy(synchash_);
-
-	copy.finish_checksum();
-	return copy.get_checksum();
+	return synchash_.get();
 }
 
 /**
@@ -971,7 +990,6 @@ void Game::sample_statistics() {
 	std::vector<uint32_t> nr_workers;
 	std::vector<uint32_t> nr_wares;
 	std::vector<uint32_t> productivity;
-	std::vector<uint32_t> nr_production_sites;
 	std::vector<uint32_t> custom_statistic;
 	land_size.resize(nr_plrs);
 	nr_buildings.resize(nr_plrs);
@@ -985,34 +1003,13 @@ void Game::sample_statistics() {
 	nr_workers.resize(nr_plrs);
 	nr_wares.resize(nr_plrs);
 	productivity.resize(nr_plrs);
-	nr_production_sites.resize(nr_plrs);
 	custom_statistic.resize(nr_plrs);
 
-	//  We walk the map, to gain all needed information.
-	const Map& themap = map();
-	Extent const extent = themap.extent();
-	iterate_Map_FCoords(themap, extent, fc) {
-		if (PlayerNumber const owner = fc.field->get_owned_by())
-			++land_size[owner - 1];
-
-		// Get the immovable
-		if (upcast(Building, building, fc.field->get_immovable()))
-			if (building->get_position() == fc) {  // only count main location
-				uint8_t const player_index = building->owner().player_number() - 1;
-				++nr_buildings[player_index];
-
-				//  If it is a productionsite, add its productivity.
-				if (upcast(ProductionSite, productionsite, building)) {
-					++nr_production_sites[player_index];
-					productivity[player_index] += productionsite->get_statistics_percent();
-				}
-			}
-
-		// Now, walk the bobs
-		for (Bob const* b = fc.field->get_first_bob(); b; b = b->get_next_bob())
-			if (upcast(Soldier const, s, b))
-				miltary_strength[s->owner().player_number() - 1] +=
-				   s->get_level(TrainingAttribute::kTotal) + 1;  //  So that level 0 also counts.
+	//  Land size, buildings, productivity and military strength are kept up to
+	//  date incrementally by the map and the players.
+	const FieldColumns& field_columns = map().field_columns();
+	iterate_player_numbers(p, nr_plrs) {
+		land_size[p - 1] = field_columns.land_size(p);
 	}
 
 	//  Number of workers / wares / casualties / kills.
@@ -1041,12 +1038,9 @@ void Game::sample_statistics() {
 		nr_msites_defeated[p - 1] = plr->msites_defeated();
 		nr_civil_blds_lost[p - 1] = plr->civil_blds_lost();
 		nr_civil_blds_defeated[p - 1] = plr->civil_blds_defeated();
-	}
-
-	// Now, divide the statistics
-	for (uint32_t i = 0; i < map().get_nrplayers(); ++i) {
-		if (productivity[i])
-			productivity[i] /= nr_production_sites[i];
+		nr_buildings[p - 1] = plr->nr_buildings();
+		productivity[p - 1] = plr->productivity();
+		miltary_strength[p - 1] = plr->military_strength();
 	}
 
 	// If there is a hook function defined to sample special statistics in this
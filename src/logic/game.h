@@ -27,6 +27,7 @@
 #include "logic/cmd_queue.h"
 #include "logic/editor_game_base.h"
 #include "logic/save_handler.h"
+#include "logic/sync_hash.h"
 #include "logic/trade_agreement.h"
 #include "random/random.h"
 #include "scripting/logic.h"
@@ -176,6 +177,7 @@ public:
 	void set_write_replay(bool wr);
 	void set_write_syncstream(bool wr);
 	void save_syncstream(bool save);
+	// 'loader_ui' can be nullptr for headless games
 	void init_newgame(UI::ProgressWindow* loader_ui, const GameSettings&);
 	void init_savegame(UI::ProgressWindow* loader_ui, const GameSettings&);
 
@@ -187,6 +189,11 @@ public:
 	         bool replay,
 	         const std::string& prefix_for_replays);
 
+	// Does the same setup as run(), but without loading graphics and without
+	// entering the UI loop. Afterwards, the game is running and the caller
+	// advances it through its game controller and the command queue.
+	void start_headless(StartGameType, const std::string& script_to_run);
+
 	// Returns the upcasted lua interface.
 	LuaGameInterface& lua() override;
 
@@ -246,8 +253,20 @@ public:
 	StreamWrite& syncstream();
 	void report_sync_request();
 	void report_desync(int32_t playernumber);
+	/// The hash of the syncstream. Despite the name of its type, this is an
+	/// MD5 sum only if that is the sync_hash_type().
 	Md5Checksum get_sync_hash() const;
 
+	/// The hash function for the syncstream. A new type takes effect when the
+	/// game is started, and all participants of a network game and replays
+	/// must use the same one.
+	SyncHashType sync_hash_type() const {
+		return sync_hash_type_;
+	}
+	void set_sync_hash_type(SyncHashType type) {
+		sync_hash_type_ = type;
+	}
+
 	void enqueue_command(Command* const);
 
 	void send_player_command(Widelands::PlayerCommand*);
@@ -322,12 +341,20 @@ public:
 	void cancel_trade(int trade_id);
 
 private:
+	// Everything that run() and start_headless() have in common
+	void prepare_to_run(UI::ProgressWindow* loader_ui,
+	                    StartGameType,
+	                    const std::string& script_to_run,
+	                    bool replay,
+	                    const std::string& prefix_for_replays);
+
 	void sync_reset();
 
-	MD5Checksum<StreamWrite> synchash_;
+	SyncHashType sync_hash_type_;
+	SyncHash synchash_;
 
 	struct SyncWrapper : public StreamWrite {
-		SyncWrapper(Game& game, StreamWrite& target)
+		SyncWrapper(Game& game, SyncHash& target)
 		   : game_(game),
 		     target_(target),
 		     counter_(0),
@@ -346,13 +373,9 @@ private:
 
 		void data(void const* data, size_t size) override;
 
-		void flush() override {
-			target_.flush();
-		}
-
 	public:
 		Game& game_;
-		StreamWrite& target_;
+		SyncHash& target_;
 		uint32_t counter_;
 		uint32_t next_diskspacecheck_;
 		std::unique_ptr<StreamWrite> dump_;
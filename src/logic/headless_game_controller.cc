@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "logic/headless_game_controller.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "base/log.h"
+#include "logic/game.h"
+#include "logic/player.h"
+#include "logic/playercommand.h"
+#include "logic/playersmanager.h"
+#include "logic/replay.h"
+
+HeadlessGameController::HeadlessGameController(Widelands::Game& game, uint32_t const step)
+   : game_(game),
+     step_(step),
+     time_(game.get_gametime()),
+     stopped_(false),
+     player_cmdserial_(0),
+     replay_ended_(false),
+     replay_end_time_(0) {
+}
+
+HeadlessGameController::~HeadlessGameController() {
+}
+
+void HeadlessGameController::set_replay(std::unique_ptr<Widelands::ReplayReader> replay) {
+	replay_ = std::move(replay);
+}
+
+void HeadlessGameController::run_until(uint32_t const end_time) {
+	while (game_.get_gametime() < end_time && !stopped_ && !replay_ended_) {
+		think();
+		time_ = std::min(time_, end_time);
+		game_.cmdqueue().run_queue(get_frametime(), game_.get_gametime_pointer());
+	}
+}
+
+void HeadlessGameController::think() {
+	time_ = game_.get_gametime() + step_;
+
+	if (replay_) {
+		// Like ReplayGameController, stop at the gametime where the end of the replay was read.
+		// The replay is kept, so that the game type stays kReplay and no AI is started.
+		if (!replay_ended_) {
+			while (Widelands::Command* const cmd = replay_->get_next_command(time_)) {
+				game_.enqueue_command(cmd);
+			}
+			if (replay_->end_of_replay()) {
+				replay_ended_ = true;
+				replay_end_time_ = game_.get_gametime();
+				log("Headless: end of replay at gametime %u\n", replay_end_time_);
+			}
+		}
+		if (replay_ended_) {
+			time_ = game_.get_gametime();
+		}
+		return;
+	}
+
+	const Widelands::PlayerNumber nr_players = game_.map().get_nrplayers();
+	iterate_players_existing(p, nr_players, game_, plr) {
+		if (p > computerplayers_.size()) {
+			computerplayers_.resize(p);
+		}
+		if (!computerplayers_[p - 1]) {
+			computerplayers_[p - 1].reset(
+			   ComputerPlayer::get_implementation(plr->get_ai())->instantiate(game_, p));
+		}
+		computerplayers_[p - 1]->think();
+	}
+}
+
+void HeadlessGameController::send_player_command(Widelands::PlayerCommand* pc) {
+	pc->set_cmdserial(++player_cmdserial_);
+	game_.enqueue_command(pc);
+}
+
+int32_t HeadlessGameController::get_frametime() {
+	return time_ - game_.get_gametime();
+}
+
+GameController::GameType HeadlessGameController::get_game_type() {
+	return replay_ ? GameController::GameType::kReplay : GameController::GameType::kSingleplayer;
+}
+
+uint32_t HeadlessGameController::real_speed() {
+	// There is no real time, so this is only informational
+	return stopped_ ? 0 : 1000;
+}
+
+uint32_t HeadlessGameController::desired_speed() {
+	return real_speed();
+}
+
+void HeadlessGameController::set_desired_speed(uint32_t const speed) {
+	if (speed == 0) {
+		stopped_ = true;
+	}
+}
+
+bool HeadlessGameController::is_paused() {
+	return stopped_;
+}
+
+void HeadlessGameController::set_paused(bool const paused) {
+	stopped_ = paused;
+}
+
+void HeadlessGameController::report_result(uint8_t p_nr,
+                                           Widelands::PlayerEndResult result,
+                                           const std::string& info) {
+	Widelands::PlayerEndStatus pes;
+	Widelands::Player* player = game_.get_player(p_nr);
+	assert(player);
+	pes.player = player->player_number();
+	pes.time = game_.get_gametime();
+	pes.result = result;
+	pes.info = info;
+	game_.player_manager()->add_player_end_status(pes);
+}
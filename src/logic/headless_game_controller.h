@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_LOGIC_HEADLESS_GAME_CONTROLLER_H
+#define WL_LOGIC_HEADLESS_GAME_CONTROLLER_H
+
+#include <memory>
+#include <vector>
+
+#include "ai/computer_player.h"
+#include "base/macros.h"
+#include "logic/game_controller.h"
+#include "logic/player_end_result.h"
+
+namespace Widelands {
+class ReplayReader;
+}  // namespace Widelands
+
+/**
+ * Runs a game without user interface, as fast as possible, in fixed steps of
+ * gametime.
+ *
+ * All players are controlled by the AI, unless a replay has been set. Then the
+ * player commands come from the replay, and the replay's sync hashes are
+ * checked against the game.
+ */
+class HeadlessGameController : public GameController {
+public:
+	/// 'step' is the gametime in ms that is simulated per think()
+	explicit HeadlessGameController(Widelands::Game&, uint32_t step = 250);
+	~HeadlessGameController() override;
+
+	/// Takes the player commands from 'replay' instead of running the AI.
+	/// The replay reader has already loaded its savegame into the game.
+	void set_replay(std::unique_ptr<Widelands::ReplayReader> replay);
+
+	/// Runs the game until the gametime has reached 'end_time', until the
+	/// replay has ended, or until the game asks to be stopped, e.g. because the
+	/// replay went out of sync.
+	void run_until(uint32_t end_time);
+
+	/// Whether all commands of the replay have been read. The game does not
+	/// advance any further then, and the AI does not take over.
+	bool replay_ended() const {
+		return replay_ended_;
+	}
+	/// The gametime at which the end of the replay was reached
+	uint32_t replay_end_time() const {
+		return replay_end_time_;
+	}
+
+	/// Whether the game has set the desired speed to 0. With a replay, this
+	/// means that the game went out of sync.
+	bool was_stopped() const {
+		return stopped_;
+	}
+
+	void think() override;
+	void send_player_command(Widelands::PlayerCommand*) override;
+	int32_t get_frametime() override;
+	GameController::GameType get_game_type() override;
+	uint32_t real_speed() override;
+	uint32_t desired_speed() override;
+	void set_desired_speed(uint32_t speed) override;
+	bool is_paused() override;
+	void set_paused(bool paused) override;
+	void report_result(uint8_t player,
+	                   Widelands::PlayerEndResult result,
+	                   const std::string& info) override;
+
+private:
+	Widelands::Game& game_;
+	const uint32_t step_;
+	uint32_t time_;
+	bool stopped_;
+	uint32_t player_cmdserial_;
+	std::unique_ptr<Widelands::ReplayReader> replay_;
+	bool replay_ended_;
+	uint32_t replay_end_time_;
+	std::vector<std::unique_ptr<ComputerPlayer>> computerplayers_;
+
+	DISALLOW_COPY_AND_ASSIGN(HeadlessGameController);
+};
+
+#endif  // end of include guard: WL_LOGIC_HEADLESS_GAME_CONTROLLER_H
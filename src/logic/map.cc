@@ -88,6 +88,8 @@ Map::Map()
      scenario_types_(NO_SCENARIO),
      width_(0),
      height_(0),
+     walk_components_(MOVECAPS_WALK),
+     swim_components_(MOVECAPS_SWIM),
      pathfieldmgr_(new PathfieldManager),
      allows_seafaring_(false) {
 }
@@ -374,10 +376,10 @@ size_t Map::count_all_fields_excluding_caps(NodeCaps caps) {
 	log("Collecting valuable fields ... ");
 	ScopedTimer timer("took %ums");
 
+	const std::vector<uint8_t>& caps_column = field_columns_.caps_column();
 	for (MapIndex i = 0; i < max_index(); ++i) {
-		Field& field = fields_[i];
-		if (!(field.nodecaps() & caps)) {
-			valuable_fields_.insert(get_fcoords(field));
+		if (!(caps_column[i] & caps)) {
+			valuable_fields_.insert(get_fcoords(fields_[i]));
 		}
 	}
 
@@ -415,6 +417,10 @@ void Map::cleanup() {
 	width_ = height_ = 0;
 
 	fields_.reset();
+	field_columns_.clear();
+	walk_components_.clear();
+	swim_components_.clear();
+	resource_observers_.clear();
 
 	starting_pos_.clear();
 	scenario_tribes_.clear();
@@ -514,6 +520,7 @@ void Map::set_origin(const Coords& new_origin) {
 	for (size_t ind = 0; ind < field_size; ind++) {
 		fields_[ind] = new_field_order[ind];
 	}
+	refresh_field_columns();
 
 	//  Inform immovables and bobs about their new coordinates.
 	for (FCoords c(Coords(0, 0), fields_.get()); c.y < height_; ++c.y) {
@@ -670,6 +677,7 @@ Map::resize(EditorGameBase& egbase, const Coords split, const int32_t w, const i
 	    split.y);
 	width_ = w;
 	height_ = h;
+	refresh_field_columns();
 
 	// Inform immovables and bobs about their new position
 	for (MapIndex idx = 0; idx < field_size; ++idx) {
@@ -711,8 +719,21 @@ void Map::set_size(const uint32_t w, const uint32_t h) {
 
 	fields_.reset(new Field[field_size]);
 	clear_array<>(&fields_, field_size);
+	field_columns_.resize(field_size);
+	walk_components_.invalidate();
+	swim_components_.invalidate();
 
-	pathfieldmgr_->set_size(field_size);
+	pathfieldmgr_->set_size(Extent(w, h));
+}
+
+void Map::refresh_field_columns() {
+	const MapIndex field_size = max_index();
+	field_columns_.resize(field_size);
+	for (MapIndex i = 0; i < field_size; ++i) {
+		field_columns_.update(i, fields_[i]);
+	}
+	walk_components_.invalidate();
+	swim_components_.invalidate();
 }
 
 int Map::needs_widelands_version_after() const {
@@ -896,7 +917,8 @@ void Map::find_reachable(const EditorGameBase& egbase,
                          const CheckStep& checkstep,
                          functorT& functor) const {
 	std::vector<Coords> queue;
-	boost::shared_ptr<Pathfields> pathfields = pathfieldmgr_->allocate();
+	// We look at the neighbours of nodes within the radius, too.
+	boost::shared_ptr<Pathfields> pathfields = pathfieldmgr_->allocate(area, area.radius + 1);
 
 	queue.push_back(area);
 
@@ -904,7 +926,7 @@ void Map::find_reachable(const EditorGameBase& egbase,
 		// Pop the last ware from the queue
 		FCoords const cur = get_fcoords(*queue.rbegin());
 		queue.pop_back();
-		Pathfield& curpf = pathfields->fields[cur.field - fields_.get()];
+		Pathfield& curpf = pathfields->fields[pathfields->index(cur)];
 
 		//  handle this node
 		functor(egbase, cur);
@@ -917,7 +939,7 @@ void Map::find_reachable(const EditorGameBase& egbase,
 			get_neighbour(cur, dir, &neighb);
 
 			if  //  node not already handled?
-			   (pathfields->fields[neighb.field - fields_.get()].cycle != pathfields->cycle &&
+			   (pathfields->fields[pathfields->index(neighb)].cycle != pathfields->cycle &&
 			    //  node within the radius?
 			    calc_distance(area, neighb) <= area.radius &&
 			    //  allowed to move onto this node?
@@ -1179,6 +1201,23 @@ Returns the number of matching fields.
 Note that list can be 0.
 ===============
 */
+uint32_t Map::find_fields_by_columns(Area<FCoords> const area,
+                                     std::vector<Coords>* list,
+                                     const FieldColumns::Predicate& predicate) const {
+	uint32_t found = 0;
+	MapRegion<Area<FCoords>> mr(*this, area);
+	do {
+		const FCoords& cur = mr.location();
+		if (predicate(field_columns_, cur.field - fields_.get())) {
+			if (list) {
+				list->push_back(cur);
+			}
+			++found;
+		}
+	} while (mr.advance(*this));
+	return found;
+}
+
 uint32_t Map::find_reachable_fields(const EditorGameBase& egbase,
                                     Area<FCoords> const area,
                                     std::vector<Coords>* list,
@@ -1268,8 +1307,12 @@ above recalc_brightness.
 ===============
 */
 void Map::recalc_nodecaps_pass1(const EditorGameBase& egbase, const FCoords& f) {
+	const uint8_t old_caps = f.field->caps;
 	f.field->caps = calc_nodecaps_pass1(egbase, f, true);
+	walk_components_.caps_changed(old_caps, f.field->caps);
+	swim_components_.caps_changed(old_caps, f.field->caps);
 	f.field->max_caps = calc_nodecaps_pass1(egbase, f, false);
+	field_columns_.update(f.field - fields_.get(), *f.field);
 }
 
 NodeCaps
@@ -1392,6 +1435,7 @@ void Map::recalc_nodecaps_pass2(const EditorGameBase& egbase, const FCoords& f)
 	f.field->caps = calc_nodecaps_pass2(egbase, f, true);
 	f.field->max_caps =
 	   calc_nodecaps_pass2(egbase, f, false, static_cast<NodeCaps>(f.field->max_caps));
+	field_columns_.update_caps(f.field - fields_.get(), *f.field);
 }
 
 NodeCaps Map::calc_nodecaps_pass2(const EditorGameBase& egbase,
@@ -1785,11 +1829,33 @@ static int32_t calc_cost_d(int32_t slope) {
 	return CALC_COST_D(slope);
 }
 
-int32_t Map::calc_cost(int32_t const slope) const {
+static int32_t calc_slope_cost(int32_t const slope) {
 	return BASE_COST_PER_FIELD * (2 * SLOPE_COST_DIVISOR + calc_cost_d(slope) - CALC_COST_D(0)) /
 	       (2 * SLOPE_COST_DIVISOR);
 }
 
+// The costs of all slopes that can occur on a map, indexed by slope +
+// MAX_FIELD_HEIGHT, so that pathfinding need not do the arithmetic for every
+// step it looks at.
+static std::vector<int32_t> calc_slope_costs() {
+	std::vector<int32_t> result(2 * MAX_FIELD_HEIGHT + 1);
+	for (int32_t slope = -MAX_FIELD_HEIGHT; slope <= MAX_FIELD_HEIGHT; ++slope) {
+		result[slope + MAX_FIELD_HEIGHT] = calc_slope_cost(slope);
+	}
+	return result;
+}
+static const std::vector<int32_t>& slope_costs() {
+	static const std::vector<int32_t> costs = calc_slope_costs();
+	return costs;
+}
+
+int32_t Map::calc_cost(int32_t const slope) const {
+	if (-MAX_FIELD_HEIGHT <= slope && slope <= MAX_FIELD_HEIGHT) {
+		return slope_costs()[slope + MAX_FIELD_HEIGHT];
+	}
+	return calc_slope_cost(slope);
+}
+
 /*
 ===============
 Return the time it takes to walk the given step from coords in the given
@@ -1986,19 +2052,41 @@ int32_t Map::findpath(Coords instart,
 	if (!checkstep.reachable_dest(*this, end))
 		return -1;
 
+	// Don't search the whole island when the destination is on another one
+	if (!checkstep.may_be_reachable(*this, start, end))
+		return -1;
+
 	if (!persist)
 		upper_cost_limit = 0;
 	else
 		// assume flat terrain
 		upper_cost_limit = persist * calc_cost_estimate(start, end);
 
-	// Actual pathfinding
-	boost::shared_ptr<Pathfields> pathfields = pathfieldmgr_->allocate();
+	// Actual pathfinding. With an upper cost limit, we only ever expand nodes
+	// that can be reached with that cost, even when always walking downhill, so
+	// only their neighbours are touched.
+	boost::shared_ptr<Pathfields> pathfields =
+	   upper_cost_limit ?
+	      pathfieldmgr_->allocate(start, upper_cost_limit / calc_cost(-SLOPE_COST_STEPS) + 1) :
+	      pathfieldmgr_->allocate();
 	Pathfield::Queue Open;
-	Pathfield* curpf = &pathfields->fields[start.field - fields_.get()];
+	Pathfield* curpf = &pathfields->fields[pathfields->index(start)];
 	curpf->cycle = pathfields->cycle;
 	curpf->real_cost = 0;
 	curpf->estim_cost = calc_cost_lowerbound(start, end);
+
+	// Same as calc_cost() or calc_bidi_cost() for the step from 'from' to its
+	// neighbour 'to', but without looking up the fields again. Heights are
+	// always within [0, MAX_FIELD_HEIGHT].
+	const std::vector<int32_t>& costs = slope_costs();
+	const bool bidi_cost = flags & fpBidiCost;
+	const auto step_cost = [&costs, bidi_cost](const FCoords& from, const FCoords& to) {
+		const int32_t slope = to.field->get_height() - from.field->get_height();
+		return bidi_cost ?
+		          (costs[MAX_FIELD_HEIGHT + slope] + costs[MAX_FIELD_HEIGHT - slope]) / 2 :
+		          costs[MAX_FIELD_HEIGHT + slope];
+	};
+	const int32_t lowest_step_cost = calc_cost(-SLOPE_COST_STEPS);
 	curpf->backlink = IDLE;
 
 	Open.push(curpf);
@@ -2009,8 +2097,7 @@ int32_t Map::findpath(Coords instart,
 		curpf = Open.top();
 		Open.pop(curpf);
 
-		cur.field = fields_.get() + (curpf - pathfields->fields.get());
-		get_coords(*cur.field, cur);
+		cur = get_fcoords(pathfields->coords(curpf - pathfields->fields.get()));
 
 		if (upper_cost_limit && curpf->real_cost > upper_cost_limit)
 			break;  // upper cost limit reached, give up
@@ -2028,7 +2115,7 @@ int32_t Map::findpath(Coords instart,
 			int32_t cost;
 
 			get_neighbour(cur, *direction, &neighb);
-			Pathfield& neighbpf = pathfields->fields[neighb.field - fields_.get()];
+			Pathfield& neighbpf = pathfields->fields[pathfields->index(neighb)];
 
 			// Is the field Closed already?
 			if (neighbpf.cycle == pathfields->cycle && !neighbpf.heap_cookie.is_active())
@@ -2042,8 +2129,7 @@ int32_t Map::findpath(Coords instart,
 				continue;
 
 			// Calculate cost
-			cost = curpf->real_cost + ((flags & fpBidiCost) ? calc_bidi_cost(cur, *direction) :
-			                                                  calc_cost(cur, *direction));
+			cost = curpf->real_cost + step_cost(cur, neighb);
 
 			// If required (indicated by caps_sensitivity) we increase the path costs
 			// if the path is just crossing a field with building capabilities
@@ -2058,7 +2144,7 @@ int32_t Map::findpath(Coords instart,
 				// add to open list
 				neighbpf.cycle = pathfields->cycle;
 				neighbpf.real_cost = cost;
-				neighbpf.estim_cost = calc_cost_lowerbound(neighb, end);
+				neighbpf.estim_cost = calc_distance(neighb, end) * lowest_step_cost;
 				neighbpf.backlink = *direction;
 				Open.push(&neighbpf);
 			} else if (neighbpf.cost() > cost + neighbpf.estim_cost) {
@@ -2083,7 +2169,7 @@ int32_t Map::findpath(Coords instart,
 
 		// Reverse logic! (WALK_NW needs to find the SE neighbour)
 		get_neighbour(cur, get_reverse_dir(curpf->backlink), &cur);
-		curpf = &pathfields->fields[cur.field - fields_.get()];
+		curpf = &pathfields->fields[pathfields->index(cur)];
 	}
 
 	return result;
@@ -2107,6 +2193,41 @@ bool Map::can_reach_by_water(const Coords& field) const {
 	return false;
 }
 
+bool Map::may_be_reachable(uint8_t const movecaps,
+                           const FCoords& start,
+                           const FCoords& dest) const {
+	MovecapsComponents* components;
+	if (movecaps == MOVECAPS_WALK) {
+		components = &walk_components_;
+	} else if (movecaps == MOVECAPS_SWIM) {
+		components = &swim_components_;
+	} else {
+		return true;
+	}
+	if (start == dest) {
+		return true;
+	}
+
+	const std::vector<uint8_t>& caps = field_columns_.caps_column();
+	const uint32_t component = components->get(*this, caps, dest.field - fields_.get());
+	if (component == MovecapsComponents::kNone) {
+		return false;
+	}
+	if (components->get(*this, caps, start.field - fields_.get()) == component) {
+		return true;
+	}
+	// The start node itself might not be passable, e.g. when a bob leaves a
+	// building. The first step can go to any neighbour that has the movecaps.
+	for (Direction dir = FIRST_DIRECTION; dir <= LAST_DIRECTION; ++dir) {
+		const FCoords neighbour = get_neighbour(start, dir);
+		if ((neighbour.field->nodecaps() & movecaps) &&
+		    components->get(*this, caps, neighbour.field - fields_.get()) == component) {
+			return true;
+		}
+	}
+	return false;
+}
+
 int32_t Map::change_terrain(const EditorGameBase& egbase,
                             TCoords<FCoords> const c,
                             DescriptionIndex const terrain) {
@@ -2191,6 +2312,10 @@ void Map::initialize_resources(const FCoords& c,
 	c.field->resources = resource_type;
 	c.field->initial_res_amount = amount;
 	c.field->res_amount = amount;
+	field_columns_.update_resources(c.field - fields_.get(), *c.field);
+	if (!resource_observers_.empty()) {
+		notify_resource_observers(c);
+	}
 }
 
 void Map::set_resources(const FCoords& c, ResourceAmount amount) {
@@ -2199,6 +2324,35 @@ void Map::set_resources(const FCoords& c, ResourceAmount amount) {
 		return;
 	}
 	c.field->res_amount = amount;
+	field_columns_.update_resources(c.field - fields_.get(), *c.field);
+	if (!resource_observers_.empty()) {
+		notify_resource_observers(c);
+	}
+}
+
+void Map::add_resource_observer(const Area<Coords>& area, ResourceObserver* observer) {
+	resource_observers_.push_back(ObservedArea{area, observer});
+}
+
+void Map::remove_resource_observer(ResourceObserver* observer) {
+	resource_observers_.erase(std::remove_if(resource_observers_.begin(), resource_observers_.end(),
+	                                         [observer](const ObservedArea& observed) {
+		                                         return observed.observer == observer;
+	                                         }),
+	                          resource_observers_.end());
+}
+
+void Map::notify_resource_observers(const FCoords& c) {
+	for (const ObservedArea& observed : resource_observers_) {
+		if (calc_distance(observed.area, c) <= observed.area.radius) {
+			observed.observer->resources_changed(c);
+		}
+	}
+}
+
+void Map::set_owned_by(const FCoords& c, PlayerNumber const owner) {
+	c.field->set_owned_by(owner);
+	field_columns_.set_owner(c.field - fields_.get(), owner);
 }
 
 void Map::clear_resources(const FCoords& c) {
@@ -30,9 +30,11 @@
 #include "base/i18n.h"
 #include "economy/itransport_cost_calculator.h"
 #include "logic/field.h"
+#include "logic/field_columns.h"
 #include "logic/map_objects/findimmovable.h"
 #include "logic/map_objects/walkingdir.h"
 #include "logic/map_revision.h"
+#include "logic/movecaps_components.h"
 #include "logic/objective.h"
 #include "logic/widelands.h"
 #include "logic/widelands_geometry.h"
@@ -68,6 +70,14 @@ struct NoteFieldTerrainChanged {
 	MapIndex map_index;
 };
 
+/// Gets told about the changes to the resources within an area of the map,
+/// see Map::add_resource_observer().
+struct ResourceObserver {
+	virtual ~ResourceObserver() {
+	}
+	virtual void resources_changed(const FCoords&) = 0;
+};
+
 struct ImmovableFound {
 	BaseImmovable* object;
 	Coords coords;
@@ -339,6 +349,11 @@ public:
 	                               std::vector<Coords>* list,
 	                               const CheckStep&,
 	                               const FindNode&) const;
+	/// Like find_fields(), but the predicate only gets to see field_columns() and
+	/// the index of each node. Much cheaper than find_fields() for large areas.
+	uint32_t find_fields_by_columns(const Area<FCoords>,
+	                                std::vector<Coords>* list,
+	                                const FieldColumns::Predicate& predicate) const;
 
 	// Field logic
 	static MapIndex get_index(const Coords&, int16_t width);
@@ -410,6 +425,14 @@ public:
 	 */
 	bool can_reach_by_water(const Coords&) const;
 
+	/**
+	 * \return \c false if a bob that moves with CheckStepDefault and the given
+	 * movecaps can certainly not get from start to dest, because they lie in
+	 * different connected components of the map. Always \c true for movecaps
+	 * other than exactly MOVECAPS_WALK or MOVECAPS_SWIM.
+	 */
+	bool may_be_reachable(uint8_t movecaps, const FCoords& start, const FCoords& dest) const;
+
 	/// Sets the height to a value. Recalculates brightness. Changes the
 	/// surrounding nodes if necessary. Returns the radius that covers all
 	/// changes that were made.
@@ -433,6 +456,21 @@ public:
 	/// resource on this field is not changed.
 	void set_resources(const FCoords& coords, ResourceAmount amount);
 
+	/// Calls 'observer' for every change of the resources on the nodes within
+	/// 'area' until it is removed again. Resources must only be changed from
+	/// several threads at once (as when loading) while there are no observers.
+	void add_resource_observer(const Area<Coords>& area, ResourceObserver* observer);
+	void remove_resource_observer(ResourceObserver* observer);
+
+	/// Sets the owner of the node. Does not change the border bits, see
+	/// Field::set_owned_by().
+	void set_owned_by(const FCoords& coords, PlayerNumber owner);
+
+	/// Contiguous copies of the most frequently scanned node attributes.
+	const FieldColumns& field_columns() const {
+		return field_columns_;
+	}
+
 	/// Clears the resources, i.e. the amount will be set to 0 and the type of
 	/// resources will be kNoResource.
 	void clear_resources(const FCoords& coords);
@@ -536,7 +574,9 @@ protected:
 
 private:
 	void recalc_border(const FCoords&);
+	void refresh_field_columns();
 	void recalc_brightness(const FCoords&);
+	void notify_resource_observers(const FCoords&);
 	void recalc_nodecaps_pass1(const EditorGameBase&, const FCoords&);
 	void recalc_nodecaps_pass2(const EditorGameBase&, const FCoords& f);
 	NodeCaps
@@ -577,6 +617,15 @@ private:
 	std::vector<Coords> starting_pos_;  //  players' starting positions
 
 	std::unique_ptr<Field[]> fields_;
+	FieldColumns field_columns_;
+	mutable MovecapsComponents walk_components_;
+	mutable MovecapsComponents swim_components_;
+
+	struct ObservedArea {
+		Area<Coords> area;
+		ResourceObserver* observer;
+	};
+	std::vector<ObservedArea> resource_observers_;
 
 	std::unique_ptr<PathfieldManager> pathfieldmgr_;
 	std::vector<std::string> scenario_tribes_;
@@ -73,6 +73,18 @@ bool CheckStepAnd::reachable_dest(const Map& map, const FCoords& dest) const {
 	return true;
 }
 
+bool may_reach(const CheckStepAnd& checkstep,
+               const Map& map,
+               const FCoords& start,
+               const FCoords& dest) {
+	for (const CheckStep& sub : checkstep.subs) {
+		if (!sub.may_be_reachable(map, start, dest)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 /*
 ===============
 CheckStepDefault
@@ -108,6 +120,13 @@ bool CheckStepDefault::reachable_dest(const Map& map, const FCoords& dest) const
 	return true;
 }
 
+bool may_reach(const CheckStepDefault& checkstep,
+               const Map& map,
+               const FCoords& start,
+               const FCoords& dest) {
+	return map.may_be_reachable(checkstep.movecaps_, start, dest);
+}
+
 /*
 ===============
 CheckStepWalkOn
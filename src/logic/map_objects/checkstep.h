@@ -32,6 +32,16 @@ namespace Widelands {
 class Map;
 class Player;
 
+/**
+ * Most CheckStep implementations can't tell cheaply whether a destination is
+ * reachable, so by default, everything might be. Implementations that can
+ * overload this function.
+ */
+template <typename T>
+bool may_reach(const T&, const Map&, const FCoords& /* start */, const FCoords& /* dest */) {
+	return true;
+}
+
 struct CheckStep {
 	enum StepId {
 		stepNormal,  //  normal step treatment
@@ -46,6 +56,8 @@ private:
 		virtual bool allowed(
 		   const Map&, const FCoords& start, const FCoords& end, int32_t dir, StepId id) const = 0;
 		virtual bool reachable_dest(const Map&, const FCoords& dest) const = 0;
+		virtual bool
+		may_be_reachable(const Map&, const FCoords& start, const FCoords& dest) const = 0;
 	};
 	template <typename T> struct Capsule : public BaseCapsule {
 		Capsule(const T& init_op) : op(init_op) {
@@ -61,6 +73,11 @@ private:
 		bool reachable_dest(const Map& map, const FCoords& dest) const override {
 			return op.reachable_dest(map, dest);
 		}
+		bool may_be_reachable(const Map& map,
+		                      const FCoords& start,
+		                      const FCoords& dest) const override {
+			return may_reach(op, map, start, dest);
+		}
 
 		const T op;
 	};
@@ -94,6 +111,15 @@ public:
 	bool reachable_dest(const Map& map, const FCoords& dest) const {
 		return capsule->reachable_dest(map, dest);
 	}
+
+	/**
+	 * \return \c false if there is certainly no path from start to dest, e.g.
+	 * because they are on different islands. Cheap enough to be checked
+	 * before every path search.
+	 */
+	bool may_be_reachable(const Map& map, const FCoords& start, const FCoords& dest) const {
+		return capsule->may_be_reachable(map, start, dest);
+	}
 };
 
 /**
@@ -111,9 +137,13 @@ struct CheckStepAnd {
 	bool reachable_dest(const Map&, const FCoords& dest) const;
 
 private:
+	friend bool may_reach(const CheckStepAnd&, const Map&, const FCoords&, const FCoords&);
+
 	std::vector<CheckStep> subs;
 };
 
+bool may_reach(const CheckStepAnd&, const Map&, const FCoords& start, const FCoords& dest);
+
 /**
  * Implements the default step checking behaviours that should be used for all
  * normal bobs.
@@ -130,9 +160,13 @@ struct CheckStepDefault {
 	bool reachable_dest(const Map&, const FCoords& dest) const;
 
 private:
+	friend bool may_reach(const CheckStepDefault&, const Map&, const FCoords&, const FCoords&);
+
 	uint8_t movecaps_;
 };
 
+bool may_reach(const CheckStepDefault&, const Map&, const FCoords& start, const FCoords& dest);
+
 /**
  * Implements the default step checking behaviours with one exception: we can
  * move from a walkable field onto an unwalkable one.
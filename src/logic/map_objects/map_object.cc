@@ -28,6 +28,7 @@
 #include <string>
 
 #include "base/log.h"
+#include "base/size_class_pool.h"
 #include "base/wexception.h"
 #include "graphic/animation/animation_manager.h"
 #include "graphic/font_handler.h"
@@ -47,6 +48,15 @@
 
 namespace {
 char const* const animation_direction_names[6] = {"_ne", "_e", "_se", "_sw", "_w", "_nw"};
+
+// Never destroyed, because map objects can outlive static destruction
+// (e.g. the soldier prototype in Economy).
+// The game logic runs on a single thread, so the pool is not synchronized.
+SizeClassPool& map_object_pool() {
+	static SizeClassPool* pool = new SizeClassPool();
+	return *pool;
+}
+
 }  // namespace
 
 namespace Widelands {
@@ -151,9 +161,14 @@ void CmdAct::write(FileWrite& fw, EditorGameBase& egbase, MapObjectSaver& mos) {
 	fw.unsigned_32(arg);
 }
 
+constexpr Serial ObjectManager::kPageSize;
+
+ObjectManager::ObjectManager() : lastserial_(0), nr_objects_(0) {
+}
+
 ObjectManager::~ObjectManager() {
 	// better not throw an exception in a destructor...
-	if (!objects_.empty())
+	if (nr_objects_)
 		log("ObjectManager: ouch! remaining objects\n");
 
 	log("lastserial: %i\n", lastserial_);
@@ -163,10 +178,20 @@ ObjectManager::~ObjectManager() {
  * Clear all objects
  */
 void ObjectManager::cleanup(EditorGameBase& egbase) {
-	while (!objects_.empty()) {
-		MapObjectMap::iterator it = objects_.begin();
-		it->second->remove(egbase);
+	// Removing an object can remove others, so look up each serial afresh
+	for (Serial serial = 1; nr_objects_ && serial <= lastserial_; ++serial) {
+		const size_t page = serial / kPageSize;
+		if (!pages_[page]) {
+			// Skip to the first serial of the next page
+			serial = (page + 1) * kPageSize - 1;
+			continue;
+		}
+		if (MapObject* object = pages_[page]->objects[serial % kPageSize]) {
+			object->remove(egbase);
+		}
 	}
+	assert(!nr_objects_);
+	pages_.clear();
 	lastserial_ = 0;
 }
 
@@ -177,14 +202,34 @@ void ObjectManager::insert(MapObject* obj) {
 	++lastserial_;
 	assert(lastserial_);
 	obj->serial_ = lastserial_;
-	objects_[lastserial_] = obj;
+
+	const size_t page = lastserial_ / kPageSize;
+	if (page >= pages_.size()) {
+		pages_.resize(page + 1);
+	}
+	if (!pages_[page]) {
+		pages_[page].reset(new Page());
+	}
+	pages_[page]->objects[lastserial_ % kPageSize] = obj;
+	++pages_[page]->nr_objects;
+	++nr_objects_;
 }
 
 /**
  * Remove the MapObject from the manager
  */
 void ObjectManager::remove(MapObject& obj) {
-	objects_.erase(obj.serial_);
+	const size_t page = obj.serial_ / kPageSize;
+	if (page < pages_.size() && pages_[page]) {
+		MapObject*& entry = pages_[page]->objects[obj.serial_ % kPageSize];
+		if (entry) {
+			entry = nullptr;
+			--nr_objects_;
+			if (!--pages_[page]->nr_objects) {
+				pages_[page].reset();
+			}
+		}
+	}
 }
 
 /*
@@ -192,13 +237,20 @@ void ObjectManager::remove(MapObject& obj) {
  */
 std::vector<Serial> ObjectManager::all_object_serials_ordered() const {
 	std::vector<Serial> rv;
+	rv.reserve(nr_objects_);
 
-	for (const auto& o : objects_) {
-		rv.push_back(o.first);
+	// The table is ordered by serial already
+	for (size_t page = 0; page < pages_.size(); ++page) {
+		if (!pages_[page]) {
+			continue;
+		}
+		for (Serial i = 0; i < kPageSize; ++i) {
+			if (pages_[page]->objects[i]) {
+				rv.push_back(page * kPageSize + i);
+			}
+		}
 	}
 
-	std::sort(rv.begin(), rv.end());
-
 	return rv;
 }
 
@@ -257,7 +309,8 @@ MapObjectDescr::MapObjectDescr(const MapObjectType init_type,
 			throw GameDataError(
 			   "Map object %s has animations but no idle animation", init_name.c_str());
 		}
-		assert(g_gr->animations().get_representative_image(name())->width() > 0);
+		assert(g_gr->is_headless() ||
+		       g_gr->animations().get_representative_image(name())->width() > 0);
 	}
 	if (table.has_key("icon")) {
 		icon_filename_ = table.get_string("icon");
@@ -461,6 +514,14 @@ MapObject IMPLEMENTATION
 /**
  * Zero-initialize a map object
  */
+void* MapObject::operator new(size_t const size) {
+	return map_object_pool().allocate(size);
+}
+
+void MapObject::operator delete(void* const ptr, size_t const size) {
+	map_object_pool().deallocate(ptr, size);
+}
+
 MapObject::MapObject(const MapObjectDescr* const the_descr)
    : descr_(the_descr), serial_(0), logsink_(nullptr), owner_(nullptr), reserved_by_worker_(false) {
 }
@@ -20,15 +20,16 @@
 #ifndef WL_LOGIC_MAP_OBJECTS_MAP_OBJECT_H
 #define WL_LOGIC_MAP_OBJECTS_MAP_OBJECT_H
 
+#include <array>
 #include <cstring>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
 #include <boost/function.hpp>
 #include <boost/signals2.hpp>
-#include <boost/unordered_map.hpp>
 
 #include "base/log.h"
 #include "base/macros.h"
@@ -250,6 +251,11 @@ public:
 
 	virtual const Image* representative_image() const;
 
+	/// Map objects are allocated from a pool that groups them by size,
+	/// see SizeClassPool.
+	static void* operator new(size_t size);
+	static void operator delete(void* ptr, size_t size);
+
 protected:
 	explicit MapObject(MapObjectDescr const* descr);
 	virtual ~MapObject() {
@@ -445,35 +451,35 @@ inline int32_t get_reverse_dir(int32_t const dir) {
 /**
  *
  * Keeps the list of all objects currently in the game.
+ *
+ * Serials are handed out consecutively and never reused, so the objects are
+ * stored in a table indexed by serial. The table is split into pages of
+ * consecutive serials, and pages are freed as soon as all of their objects
+ * have been removed. Long-lived objects therefore keep only their own page
+ * alive, and get_object() is a plain array lookup.
  */
 struct ObjectManager {
-	using MapObjectMap = boost::unordered_map<Serial, MapObject*>;
-
-	ObjectManager() {
-		lastserial_ = 0;
-	}
+	ObjectManager();
 	~ObjectManager();
 
 	void cleanup(EditorGameBase&);
 
 	MapObject* get_object(Serial const serial) const {
-		const MapObjectMap::const_iterator it = objects_.find(serial);
-		return it != objects_.end() ? it->second : nullptr;
+		const size_t page = serial / kPageSize;
+		if (page >= pages_.size() || !pages_[page]) {
+			return nullptr;
+		}
+		return pages_[page]->objects[serial % kPageSize];
 	}
 
 	void insert(MapObject*);
 	void remove(MapObject&);
 
-	bool object_still_available(const MapObject* const t) const {
-		if (!t)
-			return false;
-		MapObjectMap::const_iterator it = objects_.begin();
-		while (it != objects_.end()) {
-			if (it->second == t)
-				return true;
-			++it;
-		}
-		return false;
+	/// Check whether \p t, which had the serial \p serial when it was stored, has not been
+	/// removed yet. \p t may be dangling. Serials are never reused, so this does not mistake
+	/// a new object that got the memory of a removed one for the old object.
+	bool object_still_available(const MapObject* const t, Serial const serial) const {
+		return t && get_object(serial) == t;
 	}
 
 	/**
@@ -483,8 +489,19 @@ struct ObjectManager {
 	std::vector<Serial> all_object_serials_ordered() const;
 
 private:
+	static constexpr Serial kPageSize = 1024;
+
+	struct Page {
+		Page() : nr_objects(0) {
+			objects.fill(nullptr);
+		}
+		std::array<MapObject*, kPageSize> objects;
+		uint32_t nr_objects;
+	};
+
 	Serial lastserial_;
-	MapObjectMap objects_;
+	size_t nr_objects_;
+	std::vector<std::unique_ptr<Page>> pages_;  ///< indexed by serial / kPageSize
 
 	DISALLOW_COPY_AND_ASSIGN(ObjectManager);
 };
@@ -576,6 +593,14 @@ struct CmdDestroyMapObject : public GameLogicCommand {
 	CmdDestroyMapObject() : GameLogicCommand(0), obj_serial(0) {
 	}  ///< For savegame loading
 	CmdDestroyMapObject(uint32_t t, MapObject&);
+
+	// Scheduled very often, so they come from the command pool
+	static void* operator new(size_t size) {
+		return CmdQueue::allocate_command(size);
+	}
+	static void operator delete(void* ptr, size_t size) {
+		CmdQueue::deallocate_command(ptr, size);
+	}
 	void execute(Game&) override;
 
 	void write(FileWrite&, EditorGameBase&, MapObjectSaver&) override;
@@ -594,6 +619,14 @@ struct CmdAct : public GameLogicCommand {
 	}  ///< For savegame loading
 	CmdAct(uint32_t t, MapObject&, int32_t a);
 
+	// Scheduled very often, so they come from the command pool
+	static void* operator new(size_t size) {
+		return CmdQueue::allocate_command(size);
+	}
+	static void operator delete(void* ptr, size_t size) {
+		CmdQueue::deallocate_command(ptr, size);
+	}
+
 	void execute(Game&) override;
 
 	void write(FileWrite&, EditorGameBase&, MapObjectSaver&) override;
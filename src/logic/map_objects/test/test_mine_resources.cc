@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "logic/map.h"
+#include "logic/map_objects/tribes/mine_resources.h"
+#include "logic/mapregion.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+using namespace Widelands;
+
+namespace {
+
+constexpr DescriptionIndex kMined = 1;
+constexpr DescriptionIndex kOther = 2;
+
+// A deterministic mix of nodes with the mined resource, including depleted ones and ones that are
+// running out, nodes with another resource and nodes without resources
+void fill_resources(Map& map) {
+	for (MapIndex i = 0; i < map.max_index(); ++i) {
+		const FCoords fcoords = map.get_fcoords(map[i]);
+		switch (i % 5) {
+		case 0:
+			map.initialize_resources(fcoords, kOther, i % 16);
+			break;
+		case 1:
+			map.initialize_resources(fcoords, kNoResource, 0);
+			break;
+		default:
+			map.initialize_resources(fcoords, kMined, (i * 7) % 16);
+			if (i % 3 == 0) {
+				map.set_resources(fcoords, (i * 7) % 3);
+			}
+		}
+	}
+}
+
+// What ProductionProgram::ActMine::execute() used to compute by walking the area on every call
+struct LinearMineResources {
+	LinearMineResources(const Map& map, const Area<FCoords>& area, DescriptionIndex resource)
+	   : total_amount(0), total_start_amount(0), total_chance(0) {
+		MapRegion<Area<FCoords>> mr(map, area);
+		do {
+			ResourceAmount amount = mr.location().field->get_resources_amount();
+			ResourceAmount start_amount = mr.location().field->get_initial_res_amount();
+			if (mr.location().field->get_resources() != resource) {
+				amount = 0;
+				start_amount = 0;
+			}
+			total_amount += amount;
+			total_start_amount += start_amount;
+			total_chance += 8 * amount;
+			if (amount == 0) {
+				total_chance += 0;
+			} else if (amount <= 2) {
+				total_chance += 6;
+			} else if (amount <= 4) {
+				total_chance += 4;
+			} else if (amount <= 6) {
+				total_chance += 2;
+			}
+		} while (mr.advance(map));
+	}
+
+	uint32_t total_amount;
+	uint32_t total_start_amount;
+	uint32_t total_chance;
+};
+
+bool linear_pick(const Map& map,
+                 const Area<FCoords>& area,
+                 DescriptionIndex resource,
+                 int32_t pick,
+                 FCoords* result) {
+	MapRegion<Area<FCoords>> mr(map, area);
+	do {
+		ResourceAmount amount = mr.location().field->get_resources_amount();
+		if (mr.location().field->get_resources() != resource) {
+			amount = 0;
+		}
+		pick -= 8 * amount;
+		if (pick < 0) {
+			*result = mr.location();
+			return true;
+		}
+	} while (mr.advance(map));
+	return false;
+}
+
+void check_totals(const MineResources& resources,
+                  const Map& map,
+                  const Area<FCoords>& area,
+                  DescriptionIndex resource) {
+	const LinearMineResources linear(map, area, resource);
+	BOOST_CHECK_EQUAL(resources.total_amount(), linear.total_amount);
+	BOOST_CHECK_EQUAL(resources.total_start_amount(), linear.total_start_amount);
+	BOOST_CHECK_EQUAL(resources.total_chance(), linear.total_chance);
+}
+
+void check_pick(const MineResources& resources,
+                const Map& map,
+                const Area<FCoords>& area,
+                DescriptionIndex resource,
+                uint32_t pick) {
+	FCoords picked;
+	FCoords expected;
+	const bool found = resources.pick(pick, &picked);
+	BOOST_REQUIRE_EQUAL(found, linear_pick(map, area, resource, pick, &expected));
+	if (found) {
+		BOOST_CHECK(picked == expected);
+		BOOST_CHECK(picked.field == expected.field);
+	}
+}
+
+void check_all_picks(const MineResources& resources,
+                     const Map& map,
+                     const Area<FCoords>& area,
+                     DescriptionIndex resource) {
+	check_totals(resources, map, area, resource);
+	for (uint32_t pick = 0; pick < resources.total_chance(); ++pick) {
+		check_pick(resources, map, area, resource, pick);
+	}
+}
+
+// Mines like ActMine until the area is exhausted and compares each step with the linear search
+void mine_until_exhausted(Map& map, const Area<FCoords>& area, DescriptionIndex resource) {
+	const MineResources resources(map, area, resource);
+	uint32_t random = 12345;
+	for (;;) {
+		check_totals(resources, map, area, resource);
+		if (resources.total_amount() == 0) {
+			break;
+		}
+		random = random * 1103515245 + 12345;
+		const uint32_t pick = (random >> 8) % resources.total_chance();
+		check_pick(resources, map, area, resource, pick);
+		FCoords node;
+		if (resources.pick(pick, &node)) {
+			BOOST_REQUIRE(node.field->get_resources_amount() > 0);
+			map.set_resources(node, node.field->get_resources_amount() - 1);
+		}
+	}
+	check_all_picks(resources, map, area, resource);
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(MineResourcesTests)
+
+BOOST_AUTO_TEST_CASE(matches_linear_search) {
+	Map map;
+	map.set_size(24, 20);
+	fill_resources(map);
+
+	// In the middle, and across the seams of the map
+	for (const Coords& center : {Coords(12, 10), Coords(0, 0), Coords(23, 19), Coords(1, 18)}) {
+		for (uint16_t radius : {0, 1, 2, 6}) {
+			const Area<FCoords> area(map.get_fcoords(center), radius);
+			for (DescriptionIndex resource : {kMined, kOther}) {
+				const MineResources resources(map, area, resource);
+				check_all_picks(resources, map, area, resource);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(follows_resource_changes) {
+	Map map;
+	map.set_size(24, 20);
+	fill_resources(map);
+
+	const Area<FCoords> area(map.get_fcoords(Coords(1, 1)), 4);
+	const MineResources resources(map, area, kMined);
+	check_all_picks(resources, map, area, kMined);
+
+	MapRegion<Area<FCoords>> mr(map, Area<FCoords>(area, area.radius + 2));
+	uint32_t i = 0;
+	do {
+		// Nodes inside and just outside of the area
+		const FCoords& fcoords = mr.location();
+		switch (i++ % 4) {
+		case 0:
+			map.set_resources(fcoords, 0);
+			break;
+		case 1:
+			map.set_resources(fcoords, 15);
+			break;
+		case 2:
+			map.initialize_resources(fcoords, kMined, 3);
+			break;
+		default:
+			map.initialize_resources(fcoords, kOther, 9);
+		}
+		check_totals(resources, map, area, kMined);
+	} while (mr.advance(map));
+	check_all_picks(resources, map, area, kMined);
+}
+
+BOOST_AUTO_TEST_CASE(mining_until_exhausted) {
+	Map map;
+	map.set_size(24, 20);
+	fill_resources(map);
+	mine_until_exhausted(map, Area<FCoords>(map.get_fcoords(Coords(23, 0)), 6), kMined);
+}
+
+// The area covers some nodes more than once
+BOOST_AUTO_TEST_CASE(small_wrapping_map) {
+	Map map;
+	map.set_size(6, 4);
+	fill_resources(map);
+
+	const Area<FCoords> area(map.get_fcoords(Coords(5, 3)), 5);
+	{
+		const MineResources resources(map, area, kMined);
+		check_all_picks(resources, map, area, kMined);
+
+		// Every change counts once for each time that the area covers the node
+		for (MapIndex i = 0; i < map.max_index(); i += 3) {
+			map.set_resources(map.get_fcoords(map[i]), i % 4);
+			check_totals(resources, map, area, kMined);
+		}
+		check_all_picks(resources, map, area, kMined);
+	}
+	mine_until_exhausted(map, area, kMined);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "logic/map_objects/map_object.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+using namespace Widelands;
+
+namespace {
+
+/// Minimal map object that only exists to be registered with the ObjectManager
+class TestingMapObject : public MapObject {
+public:
+	TestingMapObject() : MapObject(nullptr) {
+	}
+	~TestingMapObject() override {
+	}
+};
+
+using TestingObjects = std::vector<std::unique_ptr<TestingMapObject>>;
+
+void insert_objects(ObjectManager& manager, TestingObjects& objects, size_t count) {
+	for (size_t i = 0; i < count; ++i) {
+		objects.emplace_back(new TestingMapObject());
+		manager.insert(objects.back().get());
+	}
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(ObjectManagerTests)
+
+BOOST_AUTO_TEST_CASE(object_still_available_tracks_insert_and_remove) {
+	ObjectManager manager;
+	TestingObjects objects;
+	insert_objects(manager, objects, 3);
+
+	BOOST_CHECK(!manager.object_still_available(nullptr, 0));
+	for (const auto& object : objects) {
+		BOOST_CHECK(manager.object_still_available(object.get(), object->serial()));
+		BOOST_CHECK_EQUAL(manager.get_object(object->serial()), object.get());
+	}
+
+	manager.remove(*objects[1]);
+	BOOST_CHECK(manager.object_still_available(objects[0].get(), objects[0]->serial()));
+	BOOST_CHECK(!manager.object_still_available(objects[1].get(), objects[1]->serial()));
+	BOOST_CHECK(manager.object_still_available(objects[2].get(), objects[2]->serial()));
+	BOOST_CHECK(manager.get_object(objects[1]->serial()) == nullptr);
+
+	manager.remove(*objects[0]);
+	manager.remove(*objects[2]);
+	BOOST_CHECK(manager.all_object_serials_ordered().empty());
+}
+
+BOOST_AUTO_TEST_CASE(serials_span_several_pages) {
+	constexpr size_t kNumObjects = 5000;
+
+	ObjectManager manager;
+	TestingObjects objects;
+	insert_objects(manager, objects, kNumObjects);
+
+	// Empty out a whole range in the middle, then remove some scattered objects
+	std::vector<Serial> expected;
+	for (size_t i = 0; i < objects.size(); ++i) {
+		if ((i >= 1000 && i < 3500) || i % 7 == 3) {
+			manager.remove(*objects[i]);
+		} else {
+			expected.push_back(objects[i]->serial());
+		}
+	}
+
+	BOOST_CHECK(manager.all_object_serials_ordered() == expected);
+	for (size_t i = 0; i < objects.size(); ++i) {
+		const bool live = !((i >= 1000 && i < 3500) || i % 7 == 3);
+		BOOST_CHECK_EQUAL(manager.get_object(objects[i]->serial()) == objects[i].get(), live);
+	}
+	BOOST_CHECK(manager.get_object(objects.back()->serial() + 1) == nullptr);
+	BOOST_CHECK(manager.get_object(objects.back()->serial() + 100000) == nullptr);
+
+	for (Serial serial : expected) {
+		manager.remove(*manager.get_object(serial));
+	}
+	BOOST_CHECK(manager.all_object_serials_ordered().empty());
+}
+
+BOOST_AUTO_TEST_CASE(pool_reuses_memory_of_deleted_objects) {
+	TestingObjects objects;
+	for (size_t i = 0; i < 3; ++i) {
+		objects.emplace_back(new TestingMapObject());
+	}
+	const TestingMapObject* freed = objects[1].get();
+	objects[1].reset();
+	objects[1].reset(new TestingMapObject());
+	BOOST_CHECK_EQUAL(objects[1].get(), freed);
+}
+
+BOOST_AUTO_TEST_CASE(pool_reuse_does_not_revive_removed_objects) {
+	ObjectManager manager;
+	TestingObjects objects;
+	insert_objects(manager, objects, 3);
+
+	const TestingMapObject* freed = objects[1].get();
+	const Serial freed_serial = objects[1]->serial();
+	manager.remove(*objects[1]);
+	objects[1].reset();
+	objects[1].reset(new TestingMapObject());
+	manager.insert(objects[1].get());
+
+	// The pool hands out the memory again, but the new object has a new serial
+	BOOST_CHECK_EQUAL(objects[1].get(), freed);
+	BOOST_CHECK(!manager.object_still_available(freed, freed_serial));
+	BOOST_CHECK(manager.object_still_available(objects[1].get(), objects[1]->serial()));
+
+	for (const auto& object : objects) {
+		manager.remove(*object);
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
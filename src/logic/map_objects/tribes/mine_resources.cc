@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "logic/map_objects/tribes/mine_resources.h"
+
+#include <algorithm>
+
+#include "logic/mapregion.h"
+
+namespace Widelands {
+
+MineResources::MineResources(Map& map, const Area<FCoords>& area, DescriptionIndex const resource)
+   : map_(map), resource_(resource), total_amount_(0), total_start_amount_(0), total_chance_(0) {
+	MapRegion<Area<FCoords>> mr(map_, area);
+	do {
+		nodes_.push_back(Node{mr.location(), 0, 0});
+	} while (mr.advance(map_));
+
+	tree_.assign(nodes_.size() + 1, 0);
+	for (uint32_t i = 0; i < nodes_.size(); ++i) {
+		positions_.push_back(std::make_pair(map_.get_index(nodes_[i].coords), i));
+		update(i);
+	}
+	std::sort(positions_.begin(), positions_.end());
+
+	map_.add_resource_observer(Area<Coords>(area, area.radius), this);
+}
+
+MineResources::~MineResources() {
+	map_.remove_resource_observer(this);
+}
+
+bool MineResources::pick(uint32_t pick, FCoords* result) const {
+	// Descend the tree to the last node at which the sum is still <= pick
+	uint32_t position = 0;
+	uint32_t step = 1;
+	while (step * 2 < tree_.size()) {
+		step *= 2;
+	}
+	for (; step; step /= 2) {
+		if (position + step < tree_.size() && tree_[position + step] <= pick) {
+			position += step;
+			pick -= tree_[position];
+		}
+	}
+	if (position == nodes_.size()) {
+		return false;
+	}
+	*result = nodes_[position].coords;
+	return true;
+}
+
+void MineResources::resources_changed(const FCoords& coords) {
+	const auto range = std::equal_range(
+	   positions_.begin(), positions_.end(), std::make_pair(map_.get_index(coords), 0U),
+	   [](const std::pair<MapIndex, uint32_t>& a, const std::pair<MapIndex, uint32_t>& b) {
+		   return a.first < b.first;
+	   });
+	for (auto it = range.first; it != range.second; ++it) {
+		update(it->second);
+	}
+}
+
+void MineResources::update(uint32_t const position) {
+	Node& node = nodes_[position];
+	ResourceAmount amount = 0;
+	ResourceAmount start_amount = 0;
+	if (node.coords.field->get_resources() == resource_) {
+		amount = node.coords.field->get_resources_amount();
+		start_amount = node.coords.field->get_initial_res_amount();
+	}
+
+	// Unsigned overflow does the right thing for decreasing values
+	total_amount_ += amount - node.amount;
+	total_start_amount_ += start_amount - node.start_amount;
+	total_chance_ += chance(amount) - chance(node.amount);
+	const uint32_t delta = 8 * amount - 8 * node.amount;
+	for (uint32_t i = position + 1; i < tree_.size(); i += i & (~i + 1)) {
+		tree_[i] += delta;
+	}
+	node.amount = amount;
+	node.start_amount = start_amount;
+}
+
+// The chance for a node to be mined, with a penalty for nodes that are running
+// out, except for totally depleted ones.
+uint32_t MineResources::chance(ResourceAmount const amount) {
+	uint32_t result = 8 * amount;
+	if (amount == 0) {
+		result += 0;
+	} else if (amount <= 2) {
+		result += 6;
+	} else if (amount <= 4) {
+		result += 4;
+	} else if (amount <= 6) {
+		result += 2;
+	}
+	return result;
+}
+}  // namespace Widelands
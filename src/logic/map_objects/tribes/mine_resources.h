@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_LOGIC_MAP_OBJECTS_TRIBES_MINE_RESOURCES_H
+#define WL_LOGIC_MAP_OBJECTS_TRIBES_MINE_RESOURCES_H
+
+#include <utility>
+#include <vector>
+
+#include "base/macros.h"
+#include "logic/map.h"
+#include "logic/widelands.h"
+#include "logic/widelands_geometry.h"
+
+namespace Widelands {
+
+/**
+ * The amounts of one resource in the area around a mine, for
+ * ProductionProgram::ActMine. The totals are kept up to date as the resources
+ * in the area change, so a work cycle does not need to look at every node.
+ *
+ * The nodes are kept in MapRegion order, and the chance of each node to be
+ * mined is kept in a Fenwick tree, so that pick() finds the same node as
+ * walking the region and subtracting the chances until the pick is used up.
+ */
+class MineResources : public ResourceObserver {
+public:
+	MineResources(Map& map, const Area<FCoords>& area, DescriptionIndex resource);
+	~MineResources() override;
+
+	/// The remaining amount of the resource in the area
+	uint32_t total_amount() const {
+		return total_amount_;
+	}
+	/// The amount of the resource that was in the area at the start of the game
+	uint32_t total_start_amount() const {
+		return total_start_amount_;
+	}
+	/// The sum of the chances of all nodes, including a penalty for the nodes
+	/// that are running out
+	uint32_t total_chance() const {
+		return total_chance_;
+	}
+
+	/// Finds the first node at which the sum of 8 * amount over the nodes so
+	/// far exceeds 'pick'. Returns false if there is no such node.
+	bool pick(uint32_t pick, FCoords* result) const;
+
+	void resources_changed(const FCoords&) override;
+
+private:
+	struct Node {
+		FCoords coords;
+		ResourceAmount amount;
+		ResourceAmount start_amount;
+	};
+
+	/// Reads the amounts of the node at 'position' in 'nodes_' from the map
+	void update(uint32_t position);
+	static uint32_t chance(ResourceAmount amount);
+
+	Map& map_;
+	const DescriptionIndex resource_;
+	uint32_t total_amount_;
+	uint32_t total_start_amount_;
+	uint32_t total_chance_;
+	std::vector<Node> nodes_;
+	// 1-based Fenwick tree over 8 * amount of the nodes
+	std::vector<uint32_t> tree_;
+	// For resources_changed(): The nodes' map indices, with their positions in
+	// 'nodes_'. Small maps can contain a node twice.
+	std::vector<std::pair<MapIndex, uint32_t>> positions_;
+
+	DISALLOW_COPY_AND_ASSIGN(MineResources);
+};
+}  // namespace Widelands
+
+#endif  // end of include guard: WL_LOGIC_MAP_OBJECTS_TRIBES_MINE_RESOURCES_H
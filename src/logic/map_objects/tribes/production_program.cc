@@ -1158,43 +1158,10 @@ ProductionProgram::ActMine::ActMine(char* parameters,
 }
 
 void ProductionProgram::ActMine::execute(Game& game, ProductionSite& ps) const {
-	Map* map = game.mutable_map();
-
-	//  select one of the nodes randomly
-	uint32_t totalres = 0;
-	uint32_t totalchance = 0;
-	uint32_t totalstart = 0;
-
-	{
-		MapRegion<Area<FCoords>> mr(
-		   *map, Area<FCoords>(map->get_fcoords(ps.get_position()), distance_));
-		do {
-			DescriptionIndex fres = mr.location().field->get_resources();
-			ResourceAmount amount = mr.location().field->get_resources_amount();
-			ResourceAmount start_amount = mr.location().field->get_initial_res_amount();
-
-			if (fres != resource_) {
-				amount = 0;
-				start_amount = 0;
-			}
-
-			totalres += amount;
-			totalstart += start_amount;
-			totalchance += 8 * amount;
-
-			// Add penalty for fields that are running out
-			// Except for totally depleted fields or wrong ressource fields
-			// if we already know there is no ressource (left) we won't mine there
-			if (amount == 0)
-				totalchance += 0;
-			else if (amount <= 2)
-				totalchance += 6;
-			else if (amount <= 4)
-				totalchance += 4;
-			else if (amount <= 6)
-				totalchance += 2;
-		} while (mr.advance(*map));
-	}
+	const MineResources& resources = ps.mine_resources(game, resource_, distance_);
+	const uint32_t totalres = resources.total_amount();
+	const uint32_t totalchance = resources.total_chance();
+	const uint32_t totalstart = resources.total_start_amount();
 
 	//  how much is digged
 	int32_t digged_percentage = 100;
@@ -1208,34 +1175,14 @@ void ProductionProgram::ActMine::execute(Game& game, ProductionSite& ps) const {
 		if (totalres == 0)
 			return ps.program_end(game, ProgramResult::kFailed);
 
-		//  second pass through nodes
+		//  select one of the nodes randomly
 		assert(totalchance);
-		int32_t pick = game.logic_rand() % totalchance;
-
-		{
-			MapRegion<Area<FCoords>> mr(
-			   *map, Area<FCoords>(map->get_fcoords(ps.get_position()), distance_));
-			do {
-				DescriptionIndex fres = mr.location().field->get_resources();
-				ResourceAmount amount = mr.location().field->get_resources_amount();
-
-				if (fres != resource_)
-					amount = 0;
-
-				pick -= 8 * amount;
-				if (pick < 0) {
-					assert(amount > 0);
-
-					--amount;
-					map->set_resources(mr.location(), amount);
-					break;
-				}
-			} while (mr.advance(*map));
-		}
-
-		if (pick >= 0) {
+		FCoords node;
+		if (!resources.pick(game.logic_rand() % totalchance, &node)) {
 			return ps.program_end(game, ProgramResult::kFailed);
 		}
+		assert(node.field->get_resources_amount() > 0);
+		game.mutable_map()->set_resources(node, node.field->get_resources_amount() - 1);
 
 	} else {
 		//  Inform the player about an empty mine, unless
@@ -280,6 +280,10 @@ IMPLEMENTATION
 ==============================
 */
 
+ProductionSite::WorkingPosition::WorkingPosition(Request* const wr, Worker* const w)
+   : worker_request(wr), worker(w), worker_serial(w ? w->serial() : 0) {
+}
+
 ProductionSite::ProductionSite(const ProductionSiteDescr& ps_descr)
    : Building(ps_descr),
      working_positions_(new WorkingPosition[ps_descr.nr_working_positions()]),
@@ -422,6 +426,10 @@ void ProductionSite::calc_statistics() {
 	}
 	// boost::format would treat uint8_t as char
 	const unsigned int percOk = (ok * 100) / STATISTICS_VECTOR_LENGTH;
+	// Also called from the constructor, before we have an owner.
+	if (get_owner() != nullptr) {
+		get_owner()->productivity_changed(last_stat_percent_, percOk);
+	}
 	last_stat_percent_ = percOk;
 
 	const unsigned int lastPercOk = (lastOk * 100) / (STATISTICS_VECTOR_LENGTH / 2);
@@ -529,7 +537,7 @@ void ProductionSite::cleanup(EditorGameBase& egbase) {
 		working_positions_[i].worker = nullptr;
 
 		// Actually remove the worker
-		if (egbase.objects().object_still_available(w))
+		if (egbase.objects().object_still_available(w, working_positions_[i].worker_serial))
 			w->set_location(nullptr);
 	}
 
@@ -540,9 +548,22 @@ void ProductionSite::cleanup(EditorGameBase& egbase) {
 	}
 	input_queues_.clear();
 
+	mine_resources_.clear();
+
 	Building::cleanup(egbase);
 }
 
+MineResources&
+ProductionSite::mine_resources(Game& game, DescriptionIndex const resource, uint8_t const radius) {
+	std::unique_ptr<MineResources>& result = mine_resources_[std::make_pair(resource, radius)];
+	if (!result) {
+		Map* map = game.mutable_map();
+		const Area<FCoords> area(map->get_fcoords(get_position()), radius);
+		result.reset(new MineResources(*map, area, resource));
+	}
+	return *result;
+}
+
 /**
  * Create a new worker inside of us out of thin air
  *
@@ -565,9 +586,8 @@ int ProductionSite::warp_worker(EditorGameBase& egbase, const WorkerDescr& wdes)
 
 		if (upcast(Game, game, &egbase))
 			worker.start_task_idle(*game, 0, -1);
-		current->worker = &worker;
 		delete current->worker_request;
-		current->worker_request = nullptr;
+		*current = WorkingPosition(nullptr, &worker);
 		assigned = true;
 		break;
 	}
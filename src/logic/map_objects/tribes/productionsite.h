@@ -30,6 +30,7 @@
 #include "base/macros.h"
 #include "logic/map_objects/tribes/bill_of_materials.h"
 #include "logic/map_objects/tribes/building.h"
+#include "logic/map_objects/tribes/mine_resources.h"
 #include "logic/map_objects/tribes/production_program.h"
 #include "logic/map_objects/tribes/program_result.h"
 #include "scripting/lua_table.h"
@@ -190,11 +191,10 @@ public:
 	void set_stopped(bool);
 
 	struct WorkingPosition {
-		WorkingPosition(Request* const wr = nullptr, Worker* const w = nullptr)
-		   : worker_request(wr), worker(w) {
-		}
+		WorkingPosition(Request* const wr = nullptr, Worker* const w = nullptr);
 		Request* worker_request;
 		Worker* worker;
+		Serial worker_serial;  ///< to check whether 'worker' still exists
 	};
 
 	WorkingPosition const* working_positions() const {
@@ -351,6 +351,12 @@ protected:  // TrainingSite must have access to this stuff
 	std::string default_anim_;  // normally "idle", "empty", if empty mine.
 
 private:
+	/// The resources around this site for ActMine, created on first use
+	MineResources& mine_resources(Game&, DescriptionIndex resource, uint8_t radius);
+
+	std::map<std::pair<DescriptionIndex, uint8_t>, std::unique_ptr<MineResources>>
+	   mine_resources_;
+
 	enum class Trend { kUnchanged, kRising, kFalling };
 	Trend trend_;
 	std::string statistics_string_on_changed_statistics_;
@@ -792,8 +792,8 @@ void Ship::pop_destination(Game& game, PortDock& pd) {
 }
 
 // Recursively find the best ordering for our destinations
-static inline float prioritised_distance(Path& path, uint32_t priority, uint32_t items) {
-	return static_cast<float>(path.get_nsteps() * items) / (priority * priority);
+static inline float prioritised_distance(uint32_t nsteps, uint32_t priority, uint32_t items) {
+	return static_cast<float>(nsteps * items) / (priority * priority);
 }
 using DestinationsQueue = std::vector<std::pair<PortDock*, uint32_t>>;
 static std::pair<DestinationsQueue, float>
@@ -802,27 +802,31 @@ shortest_order(Game* game,
                bool is_on_dock,
                void* start,
                const DestinationsQueue& remaining_to_visit,
-               const std::map<PortDock*, uint32_t> shipping_items) {
+               const std::map<PortDock*, uint32_t>& shipping_items) {
 	const size_t nr_dests = remaining_to_visit.size();
 	assert(nr_dests > 0);
-	auto get_first_path = [game, start, remaining_to_visit, fleet, is_on_dock](
-	                         Path& path, PortDock& dest) {
+	// The number of steps from the start to 'dest', or 0 if unknown
+	auto get_first_length = [game, start, &remaining_to_visit, fleet, is_on_dock](PortDock& dest) {
+		uint32_t nsteps = 0;
 		if (is_on_dock) {
 			PortDock* p = static_cast<PortDock*>(start);
 			if (p != remaining_to_visit[0].first) {
-				fleet->get_path(*p, dest, path);
+				fleet->get_path_length(*p, dest, &nsteps);
 			}
 		} else {
+			Path path;
 			static_cast<Ship*>(start)->calculate_sea_route(*game, dest, &path);
+			nsteps = path.get_nsteps();
 		}
+		return nsteps;
 	};
 	if (nr_dests == 1) {
 		// Recursion break: Only one portdock left
-		Path path;
-		get_first_path(path, *remaining_to_visit[0].first);
 		return std::pair<DestinationsQueue, float>(
-		   remaining_to_visit, prioritised_distance(path, remaining_to_visit[0].second,
-		                                            shipping_items.at(remaining_to_visit[0].first)));
+		   remaining_to_visit,
+		   prioritised_distance(get_first_length(*remaining_to_visit[0].first),
+		                        remaining_to_visit[0].second,
+		                        shipping_items.at(remaining_to_visit[0].first)));
 	}
 
 	std::pair<DestinationsQueue, float> best_result;
@@ -836,10 +840,9 @@ shortest_order(Game* game,
 		}
 		auto result = shortest_order(game, fleet, true, pair.first, remaining, shipping_items);
 		result.first.emplace(result.first.begin(), pair);
-		Path path;
-		get_first_path(path, *pair.first);
 		const float length =
-		   result.second + prioritised_distance(path, pair.second, shipping_items.at(pair.first));
+		   result.second + prioritised_distance(get_first_length(*pair.first), pair.second,
+		                                        shipping_items.at(pair.first));
 		if (length < best_result.second) {
 			best_result.first = result.first;
 			best_result.second = length;
@@ -930,17 +933,19 @@ Ship::estimated_arrival_time(Game& game, const PortDock& dest, const PortDock* i
 	uint32_t time = 0;
 	const PortDock* iterator = nullptr;
 	for (const auto& pair : destinations_) {
-		Path path;
+		uint32_t nsteps = 0;
 		if (iterator) {
-			fleet_->get_path(*iterator, *pair.first.get(game), path);
+			fleet_->get_path_length(*iterator, *pair.first.get(game), &nsteps);
 		} else {
+			Path path;
 			calculate_sea_route(game, *pair.first.get(game), &path);
+			nsteps = path.get_nsteps();
 		}
 		iterator = pair.first.get(game);
 		if (iterator == intermediate) {
 			intermediate = nullptr;
 		}
-		time += path.get_nsteps();
+		time += nsteps;
 		if (iterator == &dest) {
 			return intermediate ? kInvalidDestination : time;
 		}
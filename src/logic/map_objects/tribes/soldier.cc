@@ -357,10 +357,17 @@ bool Soldier::init(EditorGameBase& egbase) {
 	combat_walkstart_ = 0;
 	combat_walkend_ = 0;
 
+	if (get_owner() != nullptr) {
+		get_owner()->military_strength_changed(1);
+	}
 	return Worker::init(egbase);
 }
 
 void Soldier::cleanup(EditorGameBase& egbase) {
+	if (get_owner() != nullptr) {
+		get_owner()->military_strength_changed(
+		   -static_cast<int32_t>(get_level(TrainingAttribute::kTotal) + 1));
+	}
 	Worker::cleanup(egbase);
 }
 
@@ -386,6 +393,9 @@ void Soldier::set_health_level(const uint32_t health) {
 
 	uint32_t oldmax = get_max_health();
 
+	if (get_owner() != nullptr) {
+		get_owner()->military_strength_changed(health - health_level_);
+	}
 	health_level_ = health;
 
 	uint32_t newmax = get_max_health();
@@ -395,18 +405,27 @@ void Soldier::set_attack_level(const uint32_t attack) {
 	assert(attack_level_ <= attack);
 	assert(attack <= descr().get_max_attack_level());
 
+	if (get_owner() != nullptr) {
+		get_owner()->military_strength_changed(attack - attack_level_);
+	}
 	attack_level_ = attack;
 }
 void Soldier::set_defense_level(const uint32_t defense) {
 	assert(defense_level_ <= defense);
 	assert(defense <= descr().get_max_defense_level());
 
+	if (get_owner() != nullptr) {
+		get_owner()->military_strength_changed(defense - defense_level_);
+	}
 	defense_level_ = defense;
 }
 void Soldier::set_evade_level(const uint32_t evade) {
 	assert(evade_level_ <= evade);
 	assert(evade <= descr().get_max_evade_level());
 
+	if (get_owner() != nullptr) {
+		get_owner()->military_strength_changed(evade - evade_level_);
+	}
 	evade_level_ = evade;
 }
 void Soldier::set_retreat_health(const uint32_t retreat) {
@@ -1765,6 +1784,16 @@ void Soldier::Loader::load_pointers() {
 		soldier.battle_ = &mol().get<Battle>(battle_);
 }
 
+void Soldier::Loader::load_finish() {
+	Worker::Loader::load_finish();
+
+	Soldier& soldier = get<Soldier>();
+	if (soldier.get_owner() != nullptr) {
+		soldier.get_owner()->military_strength_changed(
+		   soldier.get_level(TrainingAttribute::kTotal) + 1);
+	}
+}
+
 const Bob::Task* Soldier::Loader::get_task(const std::string& name) {
 	if (name == "attack")
 		return &taskAttack;
@@ -384,6 +384,7 @@ protected:
 
 		void load(FileRead&) override;
 		void load_pointers() override;
+		void load_finish() override;
 
 	protected:
 		const Task* get_task(const std::string& name) override;
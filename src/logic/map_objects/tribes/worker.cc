@@ -1243,9 +1243,9 @@ void Worker::cleanup(EditorGameBase& egbase) {
 		supply_ = nullptr;
 	}
 
+	// The carried ware is looked up by serial, so it is still alive if we got it
 	if (ware)
-		if (egbase.objects().object_still_available(ware))
-			ware->destroy(egbase);
+		ware->destroy(egbase);
 
 	// We are destroyed, but we were maybe idling
 	// or doing something else. Get Location might
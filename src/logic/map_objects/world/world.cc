@@ -48,6 +48,11 @@ World::~World() {
 }
 
 void World::load_graphics() {
+	// Terrains are never drawn without a display, and the placeholder images do
+	// not have the size of a texture.
+	if (g_gr->is_headless()) {
+		return;
+	}
 	for (size_t i = 0; i < terrains_->size(); ++i) {
 		TerrainDescription* terrain = terrains_->get_mutable(i);
 		for (size_t j = 0; j < terrain->texture_paths().size(); ++j) {
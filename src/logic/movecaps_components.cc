@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "logic/movecaps_components.h"
+
+#include <cassert>
+
+#include "logic/map.h"
+
+namespace Widelands {
+
+constexpr uint32_t MovecapsComponents::kNone;
+
+MovecapsComponents::MovecapsComponents(NodeCaps const movecaps)
+   : movecaps_(movecaps), dirty_(true) {
+}
+
+void MovecapsComponents::clear() {
+	labels_.clear();
+	dirty_ = true;
+}
+
+uint32_t
+MovecapsComponents::get(const Map& map, const std::vector<uint8_t>& caps, MapIndex const i) {
+	if (dirty_) {
+		relabel(map, caps);
+	}
+	return labels_[i];
+}
+
+// Whether one can step between two neighbouring nodes with the given caps, in
+// either direction. This mirrors CheckStepDefault::allowed().
+bool MovecapsComponents::connects(uint8_t const caps_a, uint8_t const caps_b) const {
+	if (movecaps_ == MOVECAPS_SWIM) {
+		return ((caps_a | caps_b) & MOVECAPS_SWIM) && (caps_a & (MOVECAPS_SWIM | MOVECAPS_WALK)) &&
+		       (caps_b & (MOVECAPS_SWIM | MOVECAPS_WALK));
+	}
+	return caps_a & caps_b & movecaps_;
+}
+
+void MovecapsComponents::relabel(const Map& map, const std::vector<uint8_t>& caps) {
+	assert(caps.size() == map.max_index());
+	const MapIndex nr_fields = caps.size();
+	const int16_t width = map.get_width();
+
+	labels_.assign(nr_fields, kNone);
+	uint32_t nr_components = 0;
+	std::vector<MapIndex> todo;
+	for (MapIndex seed = 0; seed < nr_fields; ++seed) {
+		if (labels_[seed] != kNone || !(caps[seed] & movecaps_)) {
+			continue;
+		}
+		labels_[seed] = ++nr_components;
+		todo.push_back(seed);
+		while (!todo.empty()) {
+			const MapIndex i = todo.back();
+			todo.pop_back();
+			const Coords coords(i % width, i / width);
+			for (Direction dir = FIRST_DIRECTION; dir <= LAST_DIRECTION; ++dir) {
+				Coords neighbour;
+				map.get_neighbour(coords, dir, &neighbour);
+				const MapIndex j = Map::get_index(neighbour, width);
+				if (labels_[j] == kNone && connects(caps[i], caps[j])) {
+					labels_[j] = nr_components;
+					todo.push_back(j);
+				}
+			}
+		}
+	}
+	dirty_ = false;
+}
+}  // namespace Widelands
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_LOGIC_MOVECAPS_COMPONENTS_H
+#define WL_LOGIC_MOVECAPS_COMPONENTS_H
+
+#include <vector>
+
+#include "logic/nodecaps.h"
+#include "logic/widelands_geometry.h"
+
+namespace Widelands {
+
+class Map;
+
+/**
+ * Labels the connected components of the map for bobs that use
+ * CheckStepDefault with a single movecap (MOVECAPS_WALK or MOVECAPS_SWIM):
+ * two nodes have the same label if and only if such a bob could walk (or
+ * swim) from one to the other, ignoring other bobs.
+ *
+ * For walkers, all walkable nodes that are neighbours are connected.
+ * Swimmers may also step onto the shore and back into the water, so shore
+ * nodes are part of the components of the adjacent water and can join two
+ * lakes.
+ *
+ * The labels are recomputed lazily with the next query after the Map has
+ * reported a change to the movecaps of any node via caps_changed() or
+ * invalidate().
+ */
+class MovecapsComponents {
+public:
+	/// The label of nodes that such a bob can never step onto
+	static constexpr uint32_t kNone = 0;
+
+	explicit MovecapsComponents(NodeCaps movecaps);
+
+	void invalidate() {
+		dirty_ = true;
+	}
+	/// Invalidates the labels if a node's walk or swim caps changed. Swimmers
+	/// use the shore too, so both kinds of components need to know about both.
+	void caps_changed(uint8_t const old_caps, uint8_t const new_caps) {
+		if ((old_caps ^ new_caps) & (MOVECAPS_WALK | MOVECAPS_SWIM)) {
+			dirty_ = true;
+		}
+	}
+	void clear();
+
+	/// \returns the label of the node with the given index, or kNone. 'caps'
+	/// holds the caps of all nodes of 'map'.
+	uint32_t get(const Map& map, const std::vector<uint8_t>& caps, MapIndex i);
+
+private:
+	bool connects(uint8_t caps_a, uint8_t caps_b) const;
+	void relabel(const Map& map, const std::vector<uint8_t>& caps);
+
+	const NodeCaps movecaps_;
+	bool dirty_;
+	std::vector<uint32_t> labels_;
+};
+}  // namespace Widelands
+
+#endif  // end of include guard: WL_LOGIC_MOVECAPS_COMPONENTS_H
@@ -23,41 +23,95 @@
 
 namespace Widelands {
 
-Pathfields::Pathfields(uint32_t const nrfields) : fields(new Pathfield[nrfields]), cycle(0) {
+Pathfields::Pathfields(uint32_t const nrfields)
+   : fields(new Pathfield[nrfields]),
+     cycle(0),
+     capacity_(nrfields),
+     origin_(0, 0),
+     extent_(0, 0),
+     map_extent_(0, 0) {
 }
 
-PathfieldManager::PathfieldManager() : nrfields_(0) {
+PathfieldManager::PathfieldManager() : map_extent_(0, 0) {
 }
 
-void PathfieldManager::set_size(uint32_t const nrfields) {
-	if (nrfields_ != nrfields)
-		list_.clear();
+void PathfieldManager::set_size(const Extent& map_extent) {
+	if (map_extent_.w != map_extent.w || map_extent_.h != map_extent.h) {
+		full_size_.clear();
+		windows_.clear();
+	}
 
-	nrfields_ = nrfields;
+	map_extent_ = map_extent;
 }
 
 boost::shared_ptr<Pathfields> PathfieldManager::allocate() {
-	for (boost::shared_ptr<Pathfields>& pathfield : list_) {
-		if (pathfield.use_count() == 1) {
+	boost::shared_ptr<Pathfields> pf = allocate(&full_size_, map_extent_.w * map_extent_.h);
+	pf->origin_ = Coords(0, 0);
+	pf->extent_ = map_extent_;
+	pf->map_extent_ = map_extent_;
+	return pf;
+}
+
+boost::shared_ptr<Pathfields> PathfieldManager::allocate(const Coords& center,
+                                                          uint32_t const radius) {
+	// A window that is as wide (high) as the map covers all columns (rows), no
+	// matter where it starts.
+	const auto window_size = [radius](uint16_t const map_size) {
+		return radius < map_size / 2 ? static_cast<uint16_t>(2 * radius + 1) : map_size;
+	};
+	const Extent extent(window_size(map_extent_.w), window_size(map_extent_.h));
+	const uint32_t nrfields = extent.w * extent.h;
+	if (2 * nrfields > static_cast<uint32_t>(map_extent_.w * map_extent_.h)) {
+		return allocate();
+	}
+
+	const auto window_origin = [radius](int16_t const c, uint16_t const size,
+	                                    uint16_t const map_size) {
+		if (size == map_size) {
+			return 0;
+		}
+		const int32_t result = c - static_cast<int32_t>(radius);
+		return result < 0 ? result + map_size : result;
+	};
+	boost::shared_ptr<Pathfields> pf = allocate(&windows_, nrfields);
+	pf->origin_ = Coords(window_origin(center.x, extent.w, map_extent_.w),
+	                     window_origin(center.y, extent.h, map_extent_.h));
+	pf->extent_ = extent;
+	pf->map_extent_ = map_extent_;
+	return pf;
+}
+
+boost::shared_ptr<Pathfields> PathfieldManager::allocate(List* list, uint32_t const nrfields) {
+	for (boost::shared_ptr<Pathfields>& pathfield : *list) {
+		if (pathfield.use_count() == 1 && pathfield->capacity_ >= nrfields) {
 			++pathfield->cycle;
 			if (!pathfield->cycle) {
-				clear(pathfield);
+				clear(pathfield.get());
 			}
 			return pathfield;
 		}
 	}
 
-	if (list_.size() >= 8)
+	// Replace an unused one that is too small rather than keeping both around.
+	for (boost::shared_ptr<Pathfields>& pathfield : *list) {
+		if (pathfield.use_count() == 1) {
+			pathfield.reset(new Pathfields(nrfields));
+			clear(pathfield.get());
+			return pathfield;
+		}
+	}
+
+	if (list->size() >= 8)
 		throw wexception("PathfieldManager::allocate: unbounded nesting?");
 
-	boost::shared_ptr<Pathfields> pf(new Pathfields(nrfields_));
-	clear(pf);
-	list_.push_back(pf);
+	boost::shared_ptr<Pathfields> pf(new Pathfields(nrfields));
+	clear(pf.get());
+	list->push_back(pf);
 	return pf;
 }
 
-void PathfieldManager::clear(const boost::shared_ptr<Pathfields>& pf) {
-	for (uint32_t i = 0; i < nrfields_; ++i)
+void PathfieldManager::clear(Pathfields* pf) {
+	for (uint32_t i = 0; i < pf->capacity_; ++i)
 		pf->fields[i].cycle = 0;
 	pf->cycle = 1;
 }
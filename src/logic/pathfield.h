@@ -20,6 +20,7 @@
 #ifndef WL_LOGIC_PATHFIELD_H
 #define WL_LOGIC_PATHFIELD_H
 
+#include <cassert>
 #include <memory>
 #include <vector>
 
@@ -27,6 +28,7 @@
 #include <stdint.h>
 
 #include "logic/cookie_priority_queue.h"
+#include "logic/widelands_geometry.h"
 
 namespace Widelands {
 
@@ -62,11 +64,55 @@ struct Pathfield {
 	}
 };
 
+/**
+ * The Pathfields of one search.
+ *
+ * They either cover the whole map, in which case 'index()' is the MapIndex,
+ * or only a rectangular window of it. A window is used by searches that are
+ * known to stay close to where they start; it wraps around the map's edges
+ * like the map itself.
+ */
 struct Pathfields {
 	std::unique_ptr<Pathfield[]> fields;
 	uint16_t cycle;
 
 	explicit Pathfields(uint32_t nrfields);
+
+	/// Index into 'fields' for the node at 'c', which must be inside the window.
+	uint32_t index(const Coords& c) const {
+		int32_t x = c.x - origin_.x;
+		if (x < 0) {
+			x += map_extent_.w;
+		}
+		int32_t y = c.y - origin_.y;
+		if (y < 0) {
+			y += map_extent_.h;
+		}
+		assert(x < extent_.w);
+		assert(y < extent_.h);
+		return y * extent_.w + x;
+	}
+
+	/// The inverse of 'index()'
+	Coords coords(uint32_t const i) const {
+		int32_t x = origin_.x + i % extent_.w;
+		if (x >= map_extent_.w) {
+			x -= map_extent_.w;
+		}
+		int32_t y = origin_.y + i / extent_.w;
+		if (y >= map_extent_.h) {
+			y -= map_extent_.h;
+		}
+		return Coords(x, y);
+	}
+
+private:
+	friend struct PathfieldManager;
+
+	uint32_t capacity_;
+	Coords origin_;      // The node at index 0
+	Extent extent_;      // The size of the window
+	Extent map_extent_;  // The size of the whole map
 };
 
 /**
@@ -78,16 +124,33 @@ struct Pathfields {
 struct PathfieldManager {
 	PathfieldManager();
 
-	void set_size(uint32_t nrfields);
+	void set_size(const Extent& map_extent);
+
+	/// Pathfields for the whole map.
 	boost::shared_ptr<Pathfields> allocate();
 
-private:
-	void clear(const boost::shared_ptr<Pathfields>& pf);
+	/// Pathfields for a search that only touches nodes within 'radius' of
+	/// 'center'. Small searches thus only use a small, cache friendly array.
+	/// Falls back to the whole map if the window would not be much smaller.
+	boost::shared_ptr<Pathfields> allocate(const Coords& center, uint32_t radius);
+
+	/// The number of Pathfields covering the whole map that are currently
+	/// allocated, whether in use or not.
+	size_t nr_full_size() const {
+		return full_size_.size();
+	}
 
+private:
 	using List = std::vector<boost::shared_ptr<Pathfields>>;
 
-	uint32_t nrfields_;
-	List list_;
+	// Returns unused Pathfields from 'list' with room for 'nrfields' nodes, or
+	// adds new ones, and starts a new cycle in them.
+	static boost::shared_ptr<Pathfields> allocate(List* list, uint32_t nrfields);
+	static void clear(Pathfields* pf);
+
+	Extent map_extent_;
+	List full_size_;
+	List windows_;
 };
 }  // namespace Widelands
 
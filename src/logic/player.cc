@@ -19,6 +19,7 @@
 
 #include "logic/player.h"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
@@ -46,6 +47,7 @@
 #include "logic/map_objects/tribes/building.h"
 #include "logic/map_objects/tribes/constructionsite.h"
 #include "logic/map_objects/tribes/militarysite.h"
+#include "logic/map_objects/tribes/productionsite.h"
 #include "logic/map_objects/tribes/soldier.h"
 #include "logic/map_objects/tribes/soldiercontrol.h"
 #include "logic/map_objects/tribes/trainingsite.h"
@@ -136,6 +138,10 @@ Player::Player(EditorGameBase& the_egbase,
      msites_defeated_(0),
      civil_blds_lost_(0),
      civil_blds_defeated_(0),
+     nr_buildings_(0),
+     nr_productionsites_(0),
+     productivity_sum_(0),
+     military_strength_(0),
      ship_name_counter_(0),
      fields_(nullptr),
      allowed_worker_types_(the_egbase.tribes().nrworkers(), true),
@@ -947,11 +953,20 @@ Player::find_attack_soldiers(Flag& flag, std::vector<Soldier*>* soldiers, uint32
 		soldiers->clear();
 
 	const Map& map = egbase().map();
-	std::vector<BaseImmovable*> flags;
+	const Area<FCoords> area(map.get_fcoords(flag.get_position()), 25);
+
+	// Only search the area if one of our military sites could be found there
+	std::vector<Coords> candidates;
+	military_site_flags_.find(map, Area<Coords>(area, area.radius), &candidates);
+	if (std::none_of(candidates.begin(), candidates.end(), [&map, &area](const Coords& c) {
+		    return map.may_be_reachable(MOVECAPS_WALK, area, map.get_fcoords(c));
+	    })) {
+		return 0;
+	}
 
-	map.find_reachable_immovables_unique(
-	   egbase(), Area<FCoords>(map.get_fcoords(flag.get_position()), 25), flags,
-	   CheckStepDefault(MOVECAPS_WALK), FindFlagOf(FindImmovablePlayerMilitarySite(*this)));
+	std::vector<BaseImmovable*> flags;
+	map.find_reachable_immovables_unique(egbase(), area, flags, CheckStepDefault(MOVECAPS_WALK),
+	                                     FindFlagOf(FindImmovablePlayerMilitarySite(*this)));
 
 	if (flags.empty())
 		return 0;
@@ -1145,6 +1160,9 @@ Vision Player::see_node(const Map& map, const FCoords& f, Time const gametime, b
 	}
 	if (field.vision == 1) {
 		rediscover_node(map, f);
+		++field.vision;
+		Notifications::publish(NoteFieldVision(f.field - &first_map_field, player_number()));
+		return field.vision;
 	}
 	return ++field.vision;
 }
@@ -1179,6 +1197,9 @@ Vision Player::unsee_node(MapIndex const i,
 	}
 	if (field.vision < 2) {
 		field.time_node_last_unseen = gametime;
+		if (original_vision > 1 || field.vision == 0) {
+			Notifications::publish(NoteFieldVision(i, player_number()));
+		}
 	}
 	return original_vision;
 }
@@ -1328,6 +1349,31 @@ Player::BuildingStatsVector* Player::get_mutable_building_statistics(const Descr
  * Only to be called by \ref receive
  */
 void Player::update_building_statistics(Building& building, NoteImmovable::Ownership ownership) {
+	upcast(ProductionSite, productionsite, &building);
+	if (ownership == NoteImmovable::Ownership::GAINED) {
+		++nr_buildings_;
+		if (productionsite) {
+			++nr_productionsites_;
+			productivity_sum_ += productionsite->get_statistics_percent();
+		}
+	} else {
+		--nr_buildings_;
+		if (productionsite) {
+			--nr_productionsites_;
+			productivity_sum_ -= productionsite->get_statistics_percent();
+		}
+	}
+
+	if (is_a(MilitarySite, &building)) {
+		const Map& map = egbase().map();
+		const Coords flag_position = map.br_n(building.get_position());
+		if (ownership == NoteImmovable::Ownership::GAINED) {
+			military_site_flags_.add(map, flag_position);
+		} else {
+			military_site_flags_.remove(flag_position);
+		}
+	}
+
 	upcast(ConstructionSite const, constructionsite, &building);
 	const std::string& building_name =
 	   constructionsite ? constructionsite->building().name() : building.descr().name();
@@ -28,6 +28,7 @@
 #include "economy/economy.h"
 #include "graphic/color.h"
 #include "graphic/playercolor.h"
+#include "logic/coords_buckets.h"
 #include "logic/editor_game_base.h"
 #include "logic/map_objects/tribes/building.h"
 #include "logic/map_objects/tribes/constructionsite.h"
@@ -51,6 +52,21 @@ class TribeDescr;
 struct Road;
 struct AttackController;
 
+/// Sent when a player starts or stops seeing what is currently going on at a
+/// node, or when the node is unexplored again.
+struct NoteFieldVision {
+	CAN_BE_SENT_AS_NOTE(NoteId::FieldVision)
+
+	MapIndex map_index;
+
+	// The player whose vision of the node has changed.
+	PlayerNumber player;
+
+	NoteFieldVision(MapIndex const init_map_index, PlayerNumber const init_player)
+	   : map_index(init_map_index), player(init_player) {
+	}
+};
+
 /**
  * Manage in-game aspects of players, such as tribe, team, fog-of-war, statistics,
  * messages (notification when a resource has been found etc.) and so on.
@@ -574,6 +590,29 @@ public:
 		++civil_blds_defeated_;
 	}
 
+	// General statistics that are kept up to date incrementally, so that
+	// sampling them does not need to walk the map.
+	/// The number of buildings, including construction and dismantle sites.
+	uint32_t nr_buildings() const {
+		return nr_buildings_;
+	}
+	/// The average statistics percent of all productionsites.
+	uint32_t productivity() const {
+		return nr_productionsites_ ? productivity_sum_ / nr_productionsites_ : 0;
+	}
+	/// The sum of (total level + 1) over all soldiers.
+	uint32_t military_strength() const {
+		return military_strength_;
+	}
+	/// Called by productionsites when their statistics percent changes.
+	void productivity_changed(uint8_t const old_percent, uint8_t const new_percent) {
+		productivity_sum_ = productivity_sum_ - old_percent + new_percent;
+	}
+	/// Called by soldiers when they are created, loaded, trained or removed.
+	void military_strength_changed(int32_t const delta) {
+		military_strength_ += delta;
+	}
+
 	// Statistics
 	const BuildingStatsVector& get_building_statistics(const DescriptionIndex& i) const;
 
@@ -639,6 +678,8 @@ private:
 	uint32_t casualties_, kills_;
 	uint32_t msites_lost_, msites_defeated_;
 	uint32_t civil_blds_lost_, civil_blds_defeated_;
+	uint32_t nr_buildings_, nr_productionsites_, productivity_sum_;
+	uint32_t military_strength_;
 	std::unordered_set<std::string> remaining_shipnames_;
 	// If we run out of ship names, we'll want to continue with unique numbers
 	uint32_t ship_name_counter_;
@@ -687,6 +728,9 @@ private:
 
 	PlayerBuildingStats building_stats_;
 
+	// The flags of our military sites, for find_attack_soldiers()
+	CoordsBuckets military_site_flags_;
+
 	FxId message_fx_;
 	FxId attack_fx_;
 	FxId occupied_fx_;
@@ -77,7 +77,7 @@ BillOfMaterials deserialize_bill_of_materials(StreamRead* des) {
 /*** class PlayerCommand ***/
 
 PlayerCommand::PlayerCommand(const uint32_t time, const PlayerNumber s)
-   : GameLogicCommand(time), sender_(s), cmdserial_(0) {
+   : GameLogicCommand(time, CommandCategory::kPlayerCommand), sender_(s), cmdserial_(0) {
 }
 
 void PlayerCommand::write_id_and_sender(StreamWrite& ser) {
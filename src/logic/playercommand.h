@@ -49,7 +49,8 @@ public:
 	PlayerCommand(uint32_t time, PlayerNumber);
 
 	/// For savegame loading
-	PlayerCommand() : GameLogicCommand(0), sender_(0), cmdserial_(0) {
+	PlayerCommand()
+	   : GameLogicCommand(0, CommandCategory::kPlayerCommand), sender_(0), cmdserial_(0) {
 	}
 
 	void write_id_and_sender(StreamWrite& ser);
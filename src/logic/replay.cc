@@ -40,7 +40,7 @@ namespace Widelands {
 // File format definitions
 constexpr uint32_t kReplayKnownToDesync = 0x2E21A100;
 constexpr uint32_t kReplayMagic = 0x2E21A101;
-constexpr uint8_t kCurrentPacketVersion = 3;
+constexpr uint8_t kCurrentPacketVersion = 4;
 constexpr uint32_t kSyncInterval = 200;
 
 enum { pkt_end = 2, pkt_playercommand = 3, pkt_syncreport = 4 };
@@ -105,9 +105,20 @@ ReplayReader::ReplayReader(Game& game, const std::string& filename) {
 		}
 
 		const uint8_t packet_version = cmdlog_->unsigned_8();
-		if (packet_version != kCurrentPacketVersion) {
+		if (packet_version < 3 || packet_version > kCurrentPacketVersion) {
 			throw UnhandledVersionError("ReplayReader", packet_version, kCurrentPacketVersion);
 		}
+		// Older replays were always hashed with MD5
+		SyncHashType sync_hash_type = SyncHashType::kMd5;
+		if (packet_version >= 4) {
+			const uint8_t type = cmdlog_->unsigned_8();
+			if (type > static_cast<uint8_t>(SyncHashType::kXxh64)) {
+				throw wexception("%s uses the unknown sync hash type %u", filename.c_str(),
+				                 static_cast<unsigned int>(type));
+			}
+			sync_hash_type = static_cast<SyncHashType>(type);
+		}
+		game.set_sync_hash_type(sync_hash_type);
 		game.rng().read_state(*cmdlog_);
 	} catch (...) {
 		delete cmdlog_;
@@ -239,6 +250,7 @@ ReplayWriter::ReplayWriter(Game& game, const std::string& filename)
 	cmdlog_ = g_fs->open_stream_write(filename);
 	cmdlog_->unsigned_32(kReplayMagic);
 	cmdlog_->unsigned_8(kCurrentPacketVersion);
+	cmdlog_->unsigned_8(static_cast<uint8_t>(game.sync_hash_type()));
 
 	game.rng().write_state(*cmdlog_);
 }
@@ -19,6 +19,7 @@
 
 #include "logic/save_handler.h"
 
+#include <chrono>
 #include <cstring>
 #include <memory>
 
@@ -33,6 +34,7 @@
 #include "game_io/game_saver.h"
 #include "io/filesystem/filesystem.h"
 #include "io/filesystem/filesystem_exceptions.h"
+#include "io/filesystem/memory_filesystem.h"
 #include "logic/filesystem_constants.h"
 #include "logic/game.h"
 #include "logic/game_controller.h"
@@ -49,7 +51,14 @@ SaveHandler::SaveHandler()
      autosave_filename_(kAutosavePrefix),
      fs_type_(FileSystem::ZIP),
      autosave_interval_in_ms_(kDefaultAutosaveInterval * 60 * 1000),
-     number_of_rolls_(5) {
+     number_of_rolls_(5),
+     save_in_background_(true) {
+}
+
+SaveHandler::~SaveHandler() {
+	if (background_save_ != nullptr) {
+		finish_background_save(nullptr);
+	}
 }
 
 bool SaveHandler::roll_save_files(const std::string& filename, std::string* const error) {
@@ -136,6 +145,10 @@ bool SaveHandler::check_next_tick(Widelands::Game& game, uint32_t realtime) {
  * Check if autosave is needed and allowed or save was requested by user.
  */
 void SaveHandler::think(Widelands::Game& game) {
+	if (background_save_ != nullptr) {
+		finish_background_save(&game);
+	}
+
 	if (!allow_saving_ || game.is_replay()) {
 		return;
 	}
@@ -157,6 +170,13 @@ void SaveHandler::think(Widelands::Game& game) {
 			log("Gamesave: save requested: %s\n", filename.c_str());
 			save_requested_ = false;
 			save_filename_ = "";
+		} else if (save_in_background_) {
+			// Autosave in the background. The save files are rolled and the next
+			// save is scheduled in finish_background_save().
+			save_success = start_background_save(game, &error);
+			if (save_success) {
+				return;
+			}
 		} else {
 			// Autosave ...
 			save_success = roll_save_files(filename, &error);
@@ -187,7 +207,7 @@ void SaveHandler::think(Widelands::Game& game) {
 
 		log("Autosave: save took %d ms\n", SDL_GetTicks() - realtime);
 		game.get_ibase()->log_message(_("Game saved"));
-	} else {
+	} else if (background_save_ == nullptr) {
 		saving_next_tick_ = check_next_tick(game, realtime);
 	}
 }
@@ -207,6 +227,8 @@ void SaveHandler::initialize(uint32_t realtime) {
 
 	number_of_rolls_ = get_config_int("rolling_autosave", 5);
 
+	save_in_background_ = get_config_bool("background_autosave", true);
+
 	initialized_ = true;
 }
 
@@ -263,3 +285,105 @@ bool SaveHandler::save_game(Widelands::Game& game,
 	}
 	return false;
 }
+
+/*
+ * Serialize the game into memory, then compress and write it to a temporary
+ * file on a background thread, so that the simulation does not stall while
+ * the savegame is written.
+ *
+ * Returns false and sets 'error' if the game could not be serialized.
+ */
+bool SaveHandler::start_background_save(Widelands::Game& game, std::string* const error) {
+	assert(background_save_ == nullptr);
+	ScopedTimer snapshot_timer("SaveHandler: taking the savegame snapshot took %ums");
+
+	std::shared_ptr<MemoryFilesystem> snapshot(new MemoryFilesystem());
+	std::unique_ptr<FileSystem> target;
+	const std::string temp_filename =
+	   create_file_name(kSaveDir, (boost::format("%s_00") % autosave_filename_).str()) +
+	   kTempBackupExtension;
+	try {
+		Widelands::GameSaver gs(*snapshot, game);
+		gs.save();
+
+		g_fs->ensure_directory_exists(kSaveDir);
+		// Remove the remnants of an interrupted background save.
+		g_fs->fs_unlink(temp_filename);
+		target.reset(g_fs->create_sub_file_system(temp_filename, fs_type_));
+	} catch (const std::exception& e) {
+		*error = e.what();
+		return false;
+	}
+	log("Autosave: writing %" PRIuS " bytes to %s in the background\n", snapshot->size(),
+	    temp_filename.c_str());
+
+	background_save_.reset(new BackgroundSave());
+	background_save_->autosave_filename = autosave_filename_;
+	background_save_->temp_filename = temp_filename;
+	background_save_->start_realtime = SDL_GetTicks();
+	FileSystem* const target_fs = target.get();
+	background_save_->error = std::async(std::launch::async, [snapshot, target_fs]() -> std::string {
+		try {
+			std::unique_ptr<FileSystem> fs(target_fs);
+			snapshot->copy_to(*fs);
+			// Destroying the file system finishes writing the zip file.
+			fs.reset();
+		} catch (const std::exception& e) {
+			return std::string(e.what());
+		}
+		return std::string();
+	});
+	// Now owned by the background thread.
+	target.release();
+	return true;
+}
+
+void SaveHandler::finish_background_save(Widelands::Game* game) {
+	assert(background_save_ != nullptr);
+	if (game != nullptr &&
+	    background_save_->error.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+		return;
+	}
+
+	std::string error = background_save_->error.get();
+	const std::string temp_filename = background_save_->temp_filename;
+	const std::string filename = background_save_->autosave_filename;
+	const uint32_t start_realtime = background_save_->start_realtime;
+	background_save_.reset();
+
+	bool save_success = error.empty() && roll_save_files(filename, &error);
+	if (save_success) {
+		const std::string complete_filename =
+		   create_file_name(kSaveDir, (boost::format("%s_00") % filename).str());
+		try {
+			g_fs->fs_rename(temp_filename, complete_filename);
+			log("Autosave: saved as %s\n", complete_filename.c_str());
+		} catch (const FileError& e) {
+			error = e.what();
+			save_success = false;
+		}
+	}
+
+	if (!save_success) {
+		log("Autosave: ERROR! - %s\n", error.c_str());
+		try {
+			g_fs->fs_unlink(temp_filename);
+		} catch (const FileError& e) {
+			log("Autosave: Unable to delete file %s: %s\n", temp_filename.c_str(), e.what());
+		}
+		if (game != nullptr) {
+			game->get_ibase()->log_message(_("Saving failed!"));
+		}
+		// Wait 30 seconds until next save try
+		next_save_realtime_ = SDL_GetTicks() + 30000;
+		return;
+	}
+
+	// Count save interval from end of save, like for saving in the foreground.
+	next_save_realtime_ = SDL_GetTicks() + autosave_interval_in_ms_;
+
+	log("Autosave: writing in the background took %d ms\n", SDL_GetTicks() - start_realtime);
+	if (game != nullptr) {
+		game->get_ibase()->log_message(_("Game saved"));
+	}
+}
@@ -21,6 +21,8 @@
 #define WL_LOGIC_SAVE_HANDLER_H
 
 #include <cstring>
+#include <future>
+#include <memory>
 #include <string>
 
 #include <stdint.h>
@@ -39,6 +41,8 @@ class Game;
 class SaveHandler {
 public:
 	SaveHandler();
+	// Waits for an autosave that is still being written.
+	~SaveHandler();
 
 	void think(Widelands::Game&);
 	std::string create_file_name(const std::string& dir, const std::string& filename) const;
@@ -70,6 +74,16 @@ public:
 	}
 
 private:
+	// An autosave that has been serialized into memory and is now being
+	// compressed and written to 'temp_filename' on a background thread.
+	struct BackgroundSave {
+		std::string autosave_filename;
+		std::string temp_filename;
+		uint32_t start_realtime;
+		// Empty on success, the error message otherwise.
+		std::future<std::string> error;
+	};
+
 	uint32_t next_save_realtime_;
 	bool initialized_;
 	bool allow_saving_;
@@ -82,10 +96,17 @@ private:
 	FileSystem::Type fs_type_;
 	int32_t autosave_interval_in_ms_;
 	int32_t number_of_rolls_;  // For rolling file update
+	bool save_in_background_;
+	std::unique_ptr<BackgroundSave> background_save_;
 
 	void initialize(uint32_t gametime);
 	bool roll_save_files(const std::string& filename, std::string* error);
 	bool check_next_tick(Widelands::Game& game, uint32_t realtime);
+	bool start_background_save(Widelands::Game& game, std::string* error);
+	// Rolls the autosave files and moves the new one into place once the background
+	// thread is done. If 'game' is nullptr, waits for the thread and does not
+	// report the result to the player.
+	void finish_background_save(Widelands::Game* game);
 };
 
 #endif  // end of include guard: WL_LOGIC_SAVE_HANDLER_H
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include "logic/sync_hash.h"
+
+namespace Widelands {
+
+SyncHash::SyncHash(SyncHashType const type) {
+	reset(type);
+}
+
+void SyncHash::reset(SyncHashType const type) {
+	type_ = type;
+	md5_.reset();
+	xxh64_.reset();
+	buffer_size_ = 0;
+}
+
+void SyncHash::hash_block(const void* const newdata, size_t const size) {
+	switch (type_) {
+	case SyncHashType::kMd5:
+		md5_.data(buffer_, buffer_size_);
+		md5_.data(newdata, size);
+		break;
+	case SyncHashType::kXxh64:
+		xxh64_.data(buffer_, buffer_size_);
+		xxh64_.data(newdata, size);
+		break;
+	}
+	buffer_size_ = 0;
+}
+
+Md5Checksum SyncHash::get() const {
+	Md5Checksum result;
+	switch (type_) {
+	case SyncHashType::kMd5: {
+		SimpleMD5Checksum copy(md5_);
+		copy.data(buffer_, buffer_size_);
+		copy.finish_checksum();
+		result = copy.get_checksum();
+	} break;
+	case SyncHashType::kXxh64: {
+		Xxh64 copy(xxh64_);
+		copy.data(buffer_, buffer_size_);
+		const uint64_t hash = copy.digest();
+		const uint64_t size = copy.size();
+		for (int i = 0; i < 8; ++i) {
+			result.data[i] = static_cast<uint8_t>(hash >> (8 * i));
+			result.data[8 + i] = static_cast<uint8_t>(size >> (8 * i));
+		}
+	} break;
+	}
+	return result;
+}
+
+}  // namespace Widelands
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#ifndef WL_LOGIC_SYNC_HASH_H
+#define WL_LOGIC_SYNC_HASH_H
+
+#include <cstring>
+
+#include <stdint.h>
+
+#include "base/md5.h"
+#include "base/xxh64.h"
+
+namespace Widelands {
+
+/// The hash functions that can be used for the syncstream. The values are sent
+/// over the network and stored in replays, so do not change them.
+enum class SyncHashType : uint8_t { kMd5 = 0, kXxh64 = 1 };
+
+/**
+ * Hashes the syncstream. The game logic writes only a few bytes at a time, so
+ * the writes are collected in a fixed buffer and the hash function is run
+ * over large blocks.
+ *
+ * The resulting hash always has 16 bytes. For XXH64, these are the 8 bytes of
+ * the hash followed by the 8 bytes of the number of hashed bytes, both little
+ * endian.
+ */
+class SyncHash {
+public:
+	explicit SyncHash(SyncHashType type);
+
+	/// Starts over with an empty stream, using the hash function 'type'.
+	void reset(SyncHashType type);
+
+	SyncHashType type() const {
+		return type_;
+	}
+
+	void data(const void* const newdata, size_t const size) {
+		if (size <= kBlockSize - buffer_size_) {
+			memcpy(buffer_ + buffer_size_, newdata, size);
+			buffer_size_ += size;
+		} else {
+			hash_block(newdata, size);
+		}
+	}
+
+	/// The hash of everything written since the last reset. This does not affect
+	/// the subsequent hashing.
+	Md5Checksum get() const;
+
+private:
+	static constexpr size_t kBlockSize = 4096;
+
+	// Hashes the buffer followed by 'size' bytes of 'newdata' and empties the buffer
+	void hash_block(const void* newdata, size_t size);
+
+	SyncHashType type_;
+	SimpleMD5Checksum md5_;
+	Xxh64 xxh64_;
+	size_t buffer_size_;
+	uint8_t buffer_[kBlockSize];
+};
+
+}  // namespace Widelands
+
+#endif  // end of include guard: WL_LOGIC_SYNC_HASH_H
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <utility>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "logic/cmd_queue.h"
+#include "logic/game.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+using namespace Widelands;
+
+namespace {
+
+/// Remembers the time at which it was run
+class TestingCommand : public Command {
+public:
+	TestingCommand(uint32_t const init_duetime,
+	               const uint32_t& clock,
+	               std::vector<std::pair<uint32_t, uint32_t>>* runs)
+	   : Command(init_duetime), clock_(clock), runs_(runs) {
+	}
+
+	void execute(Game&) override {
+		runs_->push_back(std::make_pair(duetime(), clock_));
+	}
+	QueueCommandTypes id() const override {
+		return QueueCommandTypes::kNone;
+	}
+
+private:
+	const uint32_t& clock_;
+	std::vector<std::pair<uint32_t, uint32_t>>* runs_;
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(CmdQueueTests)
+
+BOOST_AUTO_TEST_CASE(past_command_does_not_stall_distant_ones) {
+	constexpr uint32_t kPast = 500;
+	constexpr uint32_t kNow = 1000;
+	// Far enough ahead to wait in the queue for distant commands
+	constexpr uint32_t kFarFuture =
+	   kNow + kCommandQueueWheelSize * kCommandQueueWheelSize + kCommandQueueWheelSize + 7;
+
+	Game game;
+	CmdQueue queue(game);
+	uint32_t gametime = 0;
+	std::vector<std::pair<uint32_t, uint32_t>> runs;
+
+	queue.run_queue(kNow, gametime);
+	BOOST_CHECK_EQUAL(gametime, kNow);
+
+	queue.enqueue(new TestingCommand(kFarFuture, gametime, &runs));
+	queue.enqueue(new TestingCommand(kPast, gametime, &runs));
+	queue.enqueue(new TestingCommand(kNow + 3, gametime, &runs));
+
+	queue.run_queue(kFarFuture + 1 - kNow, gametime);
+
+	// The overdue command is run right away, and the others on time
+	BOOST_REQUIRE_EQUAL(runs.size(), 3);
+	BOOST_CHECK_EQUAL(runs[0].first, kPast);
+	BOOST_CHECK_EQUAL(runs[0].second, kNow);
+	BOOST_CHECK_EQUAL(runs[1].first, kNow + 3);
+	BOOST_CHECK_EQUAL(runs[1].second, kNow + 3);
+	BOOST_CHECK_EQUAL(runs[2].first, kFarFuture);
+	BOOST_CHECK_EQUAL(runs[2].second, kFarFuture);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "logic/coords_buckets.h"
+#include "logic/map.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+using namespace Widelands;
+
+namespace {
+
+// Neither dimension is a multiple of the bucket size, so the last buckets are smaller
+constexpr int16_t kMapWidth = 40;
+constexpr int16_t kMapHeight = 36;
+
+std::vector<Coords>
+find_sorted(const CoordsBuckets& buckets, const Map& map, const Area<Coords>& area) {
+	std::vector<Coords> result;
+	buckets.find(map, area, &result);
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+std::vector<Coords>
+find_linear(const std::vector<Coords>& all, const Map& map, const Area<Coords>& area) {
+	std::vector<Coords> result;
+	for (const Coords& coords : all) {
+		if (map.calc_distance(area, coords) <= area.radius) {
+			result.push_back(coords);
+		}
+	}
+	std::sort(result.begin(), result.end());
+	return result;
+}
+
+// Compares find() with a linear search for areas around all nodes near bucket borders and
+// map edges
+void check_all_areas(const CoordsBuckets& buckets,
+                     const Map& map,
+                     const std::vector<Coords>& all) {
+	const std::vector<int16_t> xs = {0, 1, 14, 15, 16, 17, 31, 32, 33, 38, 39};
+	const std::vector<int16_t> ys = {0, 1, 15, 16, 17, 31, 32, 33, 34, 35};
+	for (int16_t y : ys) {
+		for (int16_t x : xs) {
+			for (uint16_t radius : {0, 1, 2, 5, 9, 17, 25}) {
+				const Area<Coords> area(Coords(x, y), radius);
+				BOOST_CHECK(find_sorted(buckets, map, area) == find_linear(all, map, area));
+			}
+		}
+	}
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(CoordsBucketsTests)
+
+BOOST_AUTO_TEST_CASE(find_matches_linear_search_across_borders_and_wraparound) {
+	Map map;
+	map.set_size(kMapWidth, kMapHeight);
+
+	CoordsBuckets buckets;
+	BOOST_CHECK(buckets.empty());
+	std::vector<Coords> all;
+	for (int16_t y = 0; y < kMapHeight; y += 3) {
+		for (int16_t x = (y % 2); x < kMapWidth; x += 2) {
+			buckets.add(map, Coords(x, y));
+			all.push_back(Coords(x, y));
+		}
+	}
+	// Right at the bucket borders and map edges
+	for (const Coords& coords : {Coords(15, 16), Coords(16, 16), Coords(39, 35), Coords(32, 34),
+	                             Coords(0, 35), Coords(39, 1)}) {
+		buckets.add(map, coords);
+		all.push_back(coords);
+	}
+	BOOST_CHECK(!buckets.empty());
+	check_all_areas(buckets, map, all);
+
+	// Remove every third location and check again
+	std::vector<Coords> remaining;
+	for (size_t i = 0; i < all.size(); ++i) {
+		if (i % 3 == 0) {
+			buckets.remove(all[i]);
+		} else {
+			remaining.push_back(all[i]);
+		}
+	}
+	check_all_areas(buckets, map, remaining);
+
+	for (const Coords& coords : remaining) {
+		buckets.remove(coords);
+	}
+	BOOST_CHECK(buckets.empty());
+	BOOST_CHECK(find_sorted(buckets, map, Area<Coords>(Coords(0, 0), 25)).empty());
+}
+
+BOOST_AUTO_TEST_CASE(duplicate_locations_are_removed_one_at_a_time) {
+	Map map;
+	map.set_size(kMapWidth, kMapHeight);
+
+	CoordsBuckets buckets;
+	const Coords coords(39, 0);
+	buckets.add(map, coords);
+	buckets.add(map, coords);
+
+	// Found from the other side of the map
+	const Area<Coords> area(Coords(0, 35), 2);
+	BOOST_CHECK_EQUAL(find_sorted(buckets, map, area).size(), 2U);
+	buckets.remove(coords);
+	BOOST_CHECK_EQUAL(find_sorted(buckets, map, area).size(), 1U);
+	buckets.remove(coords);
+	BOOST_CHECK(buckets.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
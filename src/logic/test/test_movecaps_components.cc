@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "logic/map.h"
+#include "logic/movecaps_components.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+using namespace Widelands;
+
+namespace {
+
+// '.' is land, '~' is water and '#' can be neither walked on nor swum in. The walls at x = 7 and
+// x = 15 split the map into a western and an eastern part, also across the seam. In the west,
+// lakes A (left) and B (right) share the shore at x = 3, and lake C is two nodes away from both.
+// In the east, the northern and southern land only meet across the seam.
+const std::vector<std::string> kLayout = {
+   ".......#.......#",  // 0
+   ".~~.~~.#.......#",  // 1
+   ".~~.~~.#.......#",  // 2
+   ".......#########",  // 3
+   ".......#########",  // 4
+   ".~~~~~.#.......#",  // 5
+   ".~~~~~.#.......#",  // 6
+   ".......#.......#",  // 7
+};
+
+uint8_t caps_for(char c) {
+	switch (c) {
+	case '.':
+		return MOVECAPS_WALK | BUILDCAPS_FLAG;
+	case '~':
+		return MOVECAPS_SWIM;
+	default:
+		return CAPS_NONE;
+	}
+}
+
+class ComponentsFixture {
+public:
+	ComponentsFixture() : walk(MOVECAPS_WALK), swim(MOVECAPS_SWIM) {
+		map.set_size(kLayout.front().size(), kLayout.size());
+		for (const std::string& row : kLayout) {
+			for (char c : row) {
+				caps.push_back(caps_for(c));
+			}
+		}
+	}
+
+	uint32_t walk_label(int16_t x, int16_t y) {
+		return walk.get(map, caps, map.get_index(Coords(x, y)));
+	}
+	uint32_t swim_label(int16_t x, int16_t y) {
+		return swim.get(map, caps, map.get_index(Coords(x, y)));
+	}
+
+	// Changes the caps of a node the way Map::recalc_nodecaps_pass1() does
+	void set_caps(int16_t x, int16_t y, uint8_t new_caps) {
+		uint8_t& node_caps = caps[map.get_index(Coords(x, y))];
+		walk.caps_changed(node_caps, new_caps);
+		swim.caps_changed(node_caps, new_caps);
+		node_caps = new_caps;
+	}
+
+	Map map;
+	std::vector<uint8_t> caps;
+	MovecapsComponents walk;
+	MovecapsComponents swim;
+};
+
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(MovecapsComponentsTests, ComponentsFixture)
+
+BOOST_AUTO_TEST_CASE(walkers) {
+	const uint32_t west = walk_label(0, 0);
+	BOOST_CHECK(west != MovecapsComponents::kNone);
+	BOOST_CHECK_EQUAL(walk_label(6, 7), west);
+	BOOST_CHECK_EQUAL(walk_label(3, 1), west);
+	BOOST_CHECK_EQUAL(walk_label(3, 4), west);
+
+	// Water and walls
+	BOOST_CHECK_EQUAL(walk_label(1, 1), MovecapsComponents::kNone);
+	BOOST_CHECK_EQUAL(walk_label(3, 5), MovecapsComponents::kNone);
+	BOOST_CHECK_EQUAL(walk_label(7, 0), MovecapsComponents::kNone);
+	BOOST_CHECK_EQUAL(walk_label(15, 0), MovecapsComponents::kNone);
+	BOOST_CHECK_EQUAL(walk_label(10, 3), MovecapsComponents::kNone);
+
+	// The northern and southern land in the east meet across the seam only
+	const uint32_t east = walk_label(10, 1);
+	BOOST_CHECK(east != MovecapsComponents::kNone);
+	BOOST_CHECK(east != west);
+	BOOST_CHECK_EQUAL(walk_label(10, 6), east);
+	BOOST_CHECK_EQUAL(walk_label(14, 7), east);
+	BOOST_CHECK_EQUAL(walk_label(8, 0), east);
+}
+
+BOOST_AUTO_TEST_CASE(swimmers_use_the_shore) {
+	const uint32_t lake_a = swim_label(1, 1);
+	const uint32_t lake_c = swim_label(3, 6);
+	BOOST_CHECK(lake_a != MovecapsComponents::kNone);
+	BOOST_CHECK(lake_c != MovecapsComponents::kNone);
+
+	// The shore between lakes A and B joins them
+	BOOST_CHECK_EQUAL(swim_label(5, 2), lake_a);
+	BOOST_CHECK_EQUAL(swim_label(3, 1), lake_a);
+	BOOST_CHECK_EQUAL(swim_label(3, 2), lake_a);
+	BOOST_CHECK_EQUAL(swim_label(0, 1), lake_a);
+
+	// Two land nodes are too far for a swimmer
+	BOOST_CHECK(lake_c != lake_a);
+	BOOST_CHECK_EQUAL(swim_label(3, 4), lake_c);
+	BOOST_CHECK_EQUAL(swim_label(3, 3), lake_a);
+
+	// Land away from the water
+	BOOST_CHECK_EQUAL(swim_label(10, 1), MovecapsComponents::kNone);
+	BOOST_CHECK_EQUAL(swim_label(7, 1), MovecapsComponents::kNone);
+}
+
+BOOST_AUTO_TEST_CASE(changes_relabel) {
+	BOOST_CHECK(swim_label(1, 1) != swim_label(1, 6));
+	BOOST_CHECK(walk_label(0, 0) != walk_label(8, 0));
+
+	// Flooding two land nodes joins lakes A and C
+	set_caps(1, 3, MOVECAPS_SWIM);
+	set_caps(1, 4, MOVECAPS_SWIM);
+	BOOST_CHECK_EQUAL(swim_label(1, 1), swim_label(1, 6));
+	BOOST_CHECK_EQUAL(walk_label(1, 3), MovecapsComponents::kNone);
+
+	// Only the swim caps change when the flooded nodes become impassable
+	set_caps(1, 3, CAPS_NONE);
+	set_caps(1, 4, CAPS_NONE);
+	BOOST_CHECK(swim_label(1, 1) != swim_label(1, 6));
+	set_caps(1, 3, MOVECAPS_SWIM);
+	set_caps(1, 4, MOVECAPS_SWIM);
+	BOOST_CHECK_EQUAL(swim_label(1, 1), swim_label(1, 6));
+
+	// Without the shore in between, lake B is on its own
+	set_caps(3, 1, CAPS_NONE);
+	set_caps(3, 2, CAPS_NONE);
+	BOOST_CHECK(swim_label(4, 1) != swim_label(1, 1));
+	BOOST_CHECK_EQUAL(swim_label(3, 1), MovecapsComponents::kNone);
+
+	// A gap in the wall joins the western and eastern land
+	set_caps(7, 0, MOVECAPS_WALK);
+	BOOST_CHECK_EQUAL(walk_label(0, 0), walk_label(8, 0));
+	BOOST_CHECK_EQUAL(walk_label(0, 0), walk_label(10, 6));
+}
+
+BOOST_AUTO_TEST_CASE(only_movecaps_changes_invalidate) {
+	const uint32_t lake_a = swim_label(1, 1);
+	const uint32_t west = walk_label(0, 0);
+
+	// Buildcaps do not matter
+	set_caps(0, 0, MOVECAPS_WALK | BUILDCAPS_BIG);
+	caps[map.get_index(Coords(3, 1))] = CAPS_NONE;
+	caps[map.get_index(Coords(3, 2))] = CAPS_NONE;
+	caps[map.get_index(Coords(7, 0))] = MOVECAPS_WALK;
+	BOOST_CHECK_EQUAL(swim_label(4, 1), lake_a);
+	BOOST_CHECK_EQUAL(walk_label(8, 0), walk_label(10, 1));
+	BOOST_CHECK(walk_label(8, 0) != west);
+
+	// Now the labels follow all changes so far
+	set_caps(0, 0, CAPS_NONE);
+	BOOST_CHECK(swim_label(4, 1) != swim_label(1, 1));
+	BOOST_CHECK_EQUAL(walk_label(0, 0), MovecapsComponents::kNone);
+	BOOST_CHECK_EQUAL(walk_label(1, 0), walk_label(8, 0));
+
+	// And so does a forced relabel
+	caps[map.get_index(Coords(7, 0))] = CAPS_NONE;
+	swim.invalidate();
+	walk.invalidate();
+	BOOST_CHECK(walk_label(1, 0) != walk_label(8, 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "logic/pathfield.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+using namespace Widelands;
+
+namespace {
+
+constexpr uint16_t kMapWidth = 64;
+constexpr uint16_t kMapHeight = 48;
+
+int16_t wrap(int32_t value, uint16_t size) {
+	return ((value % size) + size) % size;
+}
+
+// Checks that all nodes within 'radius' of 'center' get distinct indices inside the window
+// and that coords() maps them back.
+void check_window(const Pathfields& pf, const Coords& center, int32_t radius, uint32_t nrfields) {
+	std::vector<bool> used(nrfields, false);
+	for (int32_t dy = -radius; dy <= radius; ++dy) {
+		for (int32_t dx = -radius; dx <= radius; ++dx) {
+			const Coords c(wrap(center.x + dx, kMapWidth), wrap(center.y + dy, kMapHeight));
+			const uint32_t i = pf.index(c);
+			BOOST_REQUIRE_LT(i, nrfields);
+			BOOST_CHECK(!used[i]);
+			used[i] = true;
+			BOOST_CHECK(pf.coords(i) == c);
+		}
+	}
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(PathfieldTests)
+
+BOOST_AUTO_TEST_CASE(window_index_round_trips_across_the_seam) {
+	constexpr uint32_t kRadius = 5;
+	constexpr uint32_t kWindowSize = (2 * kRadius + 1) * (2 * kRadius + 1);
+
+	PathfieldManager manager;
+	manager.set_size(Extent(kMapWidth, kMapHeight));
+
+	// In the middle, at all corners and next to each edge of the map
+	for (const Coords& center :
+	     {Coords(30, 20), Coords(0, 0), Coords(kMapWidth - 1, kMapHeight - 1),
+	      Coords(0, kMapHeight - 1), Coords(kMapWidth - 1, 0), Coords(2, 24),
+	      Coords(kMapWidth - 3, 24), Coords(30, 3), Coords(30, kMapHeight - 4)}) {
+		boost::shared_ptr<Pathfields> pf = manager.allocate(center, kRadius);
+		check_window(*pf, center, kRadius, kWindowSize);
+	}
+	// Small searches do not need Pathfields for the whole map
+	BOOST_CHECK_EQUAL(manager.nr_full_size(), 0U);
+}
+
+BOOST_AUTO_TEST_CASE(large_radius_falls_back_to_the_whole_map) {
+	PathfieldManager manager;
+	manager.set_size(Extent(kMapWidth, kMapHeight));
+
+	const Coords center(kMapWidth - 1, 1);
+	boost::shared_ptr<Pathfields> pf = manager.allocate(center, kMapHeight / 2);
+	BOOST_CHECK_EQUAL(manager.nr_full_size(), 1U);
+
+	// The index of the whole map is the MapIndex
+	for (int16_t y = 0; y < kMapHeight; ++y) {
+		for (int16_t x = 0; x < kMapWidth; ++x) {
+			const Coords c(x, y);
+			BOOST_CHECK_EQUAL(pf->index(c), static_cast<uint32_t>(y * kMapWidth + x));
+			BOOST_CHECK(pf->coords(pf->index(c)) == c);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(window_as_wide_as_the_map) {
+	// The window covers all columns, but only some rows
+	constexpr uint16_t kNarrowWidth = 8;
+	constexpr uint32_t kRadius = 4;
+
+	PathfieldManager manager;
+	manager.set_size(Extent(kNarrowWidth, kMapHeight));
+
+	const Coords center(kNarrowWidth - 1, kMapHeight - 2);
+	boost::shared_ptr<Pathfields> pf = manager.allocate(center, kRadius);
+	BOOST_CHECK_EQUAL(manager.nr_full_size(), 0U);
+
+	std::vector<bool> used(kNarrowWidth * (2 * kRadius + 1), false);
+	for (int32_t dy = -static_cast<int32_t>(kRadius); dy <= static_cast<int32_t>(kRadius); ++dy) {
+		for (int16_t x = 0; x < kNarrowWidth; ++x) {
+			const Coords c(x, wrap(center.y + dy, kMapHeight));
+			const uint32_t i = pf->index(c);
+			BOOST_REQUIRE_LT(i, used.size());
+			BOOST_CHECK(!used[i]);
+			used[i] = true;
+			BOOST_CHECK(pf->coords(i) == c);
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
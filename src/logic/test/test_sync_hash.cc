@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2019 by the Widelands Development Team
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ */
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "base/macros.h"
+#include "base/md5.h"
+#include "base/xxh64.h"
+#include "io/streamwrite.h"
+#include "logic/sync_hash.h"
+
+// Triggered by BOOST_AUTO_TEST_CASE
+CLANG_DIAG_OFF("-Wdisabled-macro-expansion")
+CLANG_DIAG_OFF("-Wused-but-marked-unused")
+
+using namespace Widelands;
+
+namespace {
+
+// Mostly the small writes of the game logic, but also writes that fill the 4 KiB buffer exactly,
+// overflow it or are larger than it
+const std::vector<size_t> kWriteSizes = {1, 2, 4, 4, 1, 0, 3,    4080, 4,    4096, 1, 4097,
+                                         2, 4, 1, 1, 4, 4, 8000, 5,    4091, 4,    1};
+
+std::vector<uint8_t> make_input() {
+	size_t total = 0;
+	for (size_t size : kWriteSizes) {
+		total += size;
+	}
+	std::vector<uint8_t> result;
+	for (size_t i = 0; i < total; ++i) {
+		result.push_back(static_cast<uint8_t>(i * 13 + i / 256));
+	}
+	return result;
+}
+
+Md5Checksum finished(const MD5Checksum<StreamWrite>& md5) {
+	MD5Checksum<StreamWrite> copy(md5);
+	copy.finish_checksum();
+	return copy.get_checksum();
+}
+
+Md5Checksum xxh64_checksum(const Xxh64& xxh64) {
+	Md5Checksum result;
+	const uint64_t hash = xxh64.digest();
+	for (int i = 0; i < 8; ++i) {
+		result.data[i] = static_cast<uint8_t>(hash >> (8 * i));
+		result.data[8 + i] = static_cast<uint8_t>(xxh64.size() >> (8 * i));
+	}
+	return result;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SyncHashTests)
+
+// The syncstream used to be written straight into MD5
+BOOST_AUTO_TEST_CASE(md5_matches_unbuffered_md5) {
+	const std::vector<uint8_t> input = make_input();
+	SyncHash sync_hash(SyncHashType::kMd5);
+	MD5Checksum<StreamWrite> unbuffered;
+	BOOST_CHECK(sync_hash.get() == finished(unbuffered));
+
+	size_t position = 0;
+	for (size_t size : kWriteSizes) {
+		sync_hash.data(input.data() + position, size);
+		unbuffered.data(input.data() + position, size);
+		position += size;
+		// Taking the hash must not disturb the hashing of later writes
+		BOOST_CHECK(sync_hash.get() == finished(unbuffered));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(xxh64_matches_unbuffered_xxh64) {
+	const std::vector<uint8_t> input = make_input();
+	SyncHash sync_hash(SyncHashType::kXxh64);
+	Xxh64 unbuffered;
+	BOOST_CHECK(sync_hash.get() == xxh64_checksum(unbuffered));
+
+	size_t position = 0;
+	for (size_t size : kWriteSizes) {
+		sync_hash.data(input.data() + position, size);
+		unbuffered.data(input.data() + position, size);
+		position += size;
+		BOOST_CHECK(sync_hash.get() == xxh64_checksum(unbuffered));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(reset_switches_the_hash_function) {
+	const std::vector<uint8_t> input = make_input();
+	SyncHash sync_hash(SyncHashType::kXxh64);
+	sync_hash.data(input.data(), 3000);
+
+	sync_hash.reset(SyncHashType::kMd5);
+	BOOST_CHECK(sync_hash.type() == SyncHashType::kMd5);
+	MD5Checksum<StreamWrite> md5;
+	BOOST_CHECK(sync_hash.get() == finished(md5));
+	sync_hash.data(input.data(), 100);
+	md5.data(input.data(), 100);
+	BOOST_CHECK(sync_hash.get() == finished(md5));
+
+	sync_hash.reset(SyncHashType::kXxh64);
+	Xxh64 xxh64;
+	sync_hash.data(input.data(), 100);
+	xxh64.data(input.data(), 100);
+	BOOST_CHECK(sync_hash.get() == xxh64_checksum(xxh64));
+	BOOST_CHECK(sync_hash.get() != finished(md5));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
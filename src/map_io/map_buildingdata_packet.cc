@@ -381,7 +381,7 @@ void MapBuildingdataPacket::read_warehouse(Warehouse& warehouse,
 						const DescriptionIndex& worker_index =
 						   tribe.worker_index(worker.descr().name().c_str());
 						if (!warehouse.incorporated_workers_.count(worker_index))
-							warehouse.incorporated_workers_[worker_index] = std::vector<Worker*>();
+							warehouse.incorporated_workers_[worker_index] = Warehouse::WorkerList();
 						warehouse.incorporated_workers_[worker_index].push_back(&worker);
 					} catch (const WException& e) {
 						throw GameDataError(
@@ -666,7 +666,7 @@ void MapBuildingdataPacket::read_productionsite(
 					throw GameDataError("site has %s, for which there is no free working "
 					                    "position",
 					                    worker_descr.name().c_str());
-				wp->worker = worker;
+				*wp = ProductionSite::WorkingPosition(nullptr, worker);
 			}
 
 			if (nr_worker_requests + nr_workers < pr_descr.nr_working_positions())
@@ -1048,22 +1048,19 @@ void MapBuildingdataPacket::write_warehouse(const Warehouse& warehouse,
 	fw.unsigned_8(0);
 
 	//  Incorporated workers, write sorted after file-serial.
-	uint32_t nworkers = 0;
-	for (const auto& cwt : warehouse.incorporated_workers_) {
-		nworkers += cwt.second.size();
-	}
-
-	fw.unsigned_16(nworkers);
 	using TWorkerMap = std::map<uint32_t, const Worker*>;
 	TWorkerMap workermap;
 	for (const auto& cwt : warehouse.incorporated_workers_) {
-		for (Worker* temp_worker : cwt.second) {
-			const Worker& w = *temp_worker;
-			assert(mos.is_object_known(w));
-			workermap.insert(std::pair<uint32_t, const Worker*>(mos.get_object_file_index(w), &w));
+		for (const OPtr<Worker>& temp_worker : cwt.second) {
+			if (const Worker* w = temp_worker.get(game)) {
+				assert(mos.is_object_known(*w));
+				workermap.insert(std::pair<uint32_t, const Worker*>(mos.get_object_file_index(*w), w));
+			}
 		}
 	}
 
+	fw.unsigned_16(workermap.size());
+
 	for (const auto& temp_worker : workermap) {
 		const Worker& obj = *temp_worker.second;
 		assert(mos.is_object_known(obj));
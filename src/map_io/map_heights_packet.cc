@@ -19,6 +19,7 @@
 
 #include "map_io/map_heights_packet.h"
 
+#include "base/parallel.h"
 #include "io/fileread.h"
 #include "io/filewrite.h"
 #include "logic/editor_game_base.h"
@@ -40,8 +41,12 @@ void MapHeightsPacket::read(FileSystem& fs, EditorGameBase& egbase, bool, MapObj
 		if (packet_version == kCurrentPacketVersion) {
 			const Map& map = egbase.map();
 			MapIndex const max_index = map.max_index();
-			for (MapIndex i = 0; i < max_index; ++i)
-				map[i].set_height(fr.unsigned_8());
+			const char* const heights = fr.data(max_index);
+			parallel_for(max_index, [&map, heights](MapIndex const begin, MapIndex const end) {
+				for (MapIndex i = begin; i < end; ++i) {
+					map[i].set_height(static_cast<uint8_t>(heights[i]));
+				}
+			});
 		} else {
 			throw UnhandledVersionError("MapHeightsPacket", packet_version, kCurrentPacketVersion);
 		}
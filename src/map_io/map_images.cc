@@ -28,7 +28,7 @@ namespace Widelands {
 
 void load_map_images(FileSystem& fs) {
 	// Read all pics.
-	if (!fs.file_exists("pics") || !fs.is_directory("pics")) {
+	if (g_gr->is_headless() || !fs.file_exists("pics") || !fs.is_directory("pics")) {
 		return;
 	}
 	for (const std::string& pname : fs.list_directory("pics")) {
@@ -19,6 +19,7 @@
 
 #include "map_io/map_node_ownership_packet.h"
 
+#include "base/parallel.h"
 #include "io/fileread.h"
 #include "io/filewrite.h"
 #include "logic/editor_game_base.h"
@@ -53,8 +54,12 @@ void MapNodeOwnershipPacket::read(FileSystem& fs,
 		if (packet_version == kCurrentPacketVersion) {
 			const Map& map = egbase.map();
 			MapIndex const max_index = map.max_index();
-			for (MapIndex i = 0; i < max_index; ++i)
-				map[i].set_owned_by(fr.unsigned_8());
+			const char* const owners = fr.data(max_index);
+			parallel_for(max_index, [&map, owners](MapIndex const begin, MapIndex const end) {
+				for (MapIndex i = begin; i < end; ++i) {
+					map[i].set_owned_by(static_cast<uint8_t>(owners[i]));
+				}
+			});
 		} else {
 			throw UnhandledVersionError(
 			   "MapNodeOwnershipPacket", packet_version, kCurrentPacketVersion);
@@ -19,7 +19,11 @@
 
 #include "map_io/map_resources_packet.h"
 
+#include <map>
+#include <vector>
+
 #include "base/log.h"
+#include "base/parallel.h"
 #include "io/fileread.h"
 #include "io/filewrite.h"
 #include "logic/editor_game_base.h"
@@ -63,16 +67,25 @@ void MapResourcesPacket::read(FileSystem& fs,
 				smap[id] = res;
 			}
 
-			for (uint16_t y = 0; y < map->get_height(); ++y) {
-				for (uint16_t x = 0; x < map->get_width(); ++x) {
-					DescriptionIndex const id = fr.unsigned_8();
-					ResourceAmount const amount = fr.unsigned_8();
-					ResourceAmount const start_amount = fr.unsigned_8();
-					const auto fcoords = map->get_fcoords(Coords(x, y));
-					map->initialize_resources(fcoords, smap[id], start_amount);
-					map->set_resources(fcoords, amount);
-				}
+			// Unknown ids map to resource 0
+			std::vector<DescriptionIndex> resource_indices(256, 0);
+			for (const auto& resource : smap) {
+				resource_indices[resource.first] = resource.second;
 			}
+
+			// Each node has its resource id, the current amount and the start amount.
+			MapIndex const max_index = map->max_index();
+			const char* const resources = fr.data(3 * max_index);
+			parallel_for(max_index, [map, &resource_indices, resources](MapIndex const begin,
+			                                                            MapIndex const end) {
+				for (MapIndex i = begin; i < end; ++i) {
+					const char* const node = resources + 3 * i;
+					const auto fcoords = map->get_fcoords((*map)[i]);
+					map->initialize_resources(fcoords, resource_indices[static_cast<uint8_t>(node[0])],
+					                          static_cast<uint8_t>(node[2]));
+					map->set_resources(fcoords, static_cast<uint8_t>(node[1]));
+				}
+			});
 		} else {
 			throw UnhandledVersionError("MapResourcesPacket", packet_version, kCurrentPacketVersion);
 		}
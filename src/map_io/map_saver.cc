@@ -24,6 +24,7 @@
 #include "base/log.h"
 #include "base/scoped_timer.h"
 #include "base/wexception.h"
+#include "graphic/graphic.h"
 #include "graphic/image_io.h"
 #include "graphic/minimap_renderer.h"
 #include "graphic/texture.h"
@@ -302,7 +303,7 @@ void MapSaver::save() {
 	}
 
 	// Write minimap
-	{
+	if (!g_gr->is_headless()) {
 		std::unique_ptr<Texture> minimap(
 		   draw_minimap(egbase_, nullptr, Rectf(), MiniMapType::kStaticMap, MiniMapLayer::Terrain));
 		FileWrite fw;
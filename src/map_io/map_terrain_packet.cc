@@ -20,8 +20,10 @@
 #include "map_io/map_terrain_packet.h"
 
 #include <map>
+#include <vector>
 
 #include "base/log.h"
+#include "base/parallel.h"
 #include "io/fileread.h"
 #include "io/filewrite.h"
 #include "logic/editor_game_base.h"
@@ -66,12 +68,24 @@ void MapTerrainPacket::read(FileSystem& fs,
 				smap[id] = world.terrains().get_index(terrain_name);
 			}
 
-			MapIndex const max_index = map.max_index();
-			for (MapIndex i = 0; i < max_index; ++i) {
-				Field& f = map[i];
-				f.set_terrain_r(smap[fr.unsigned_8()]);
-				f.set_terrain_d(smap[fr.unsigned_8()]);
+			// Unknown ids map to terrain 0
+			std::vector<DescriptionIndex> terrain_indices(256, 0);
+			for (const auto& terrain : smap) {
+				if (terrain.first < terrain_indices.size()) {
+					terrain_indices[terrain.first] = terrain.second;
+				}
 			}
+
+			MapIndex const max_index = map.max_index();
+			const char* const terrains = fr.data(2 * max_index);
+			parallel_for(max_index, [&map, &terrain_indices, terrains](MapIndex const begin,
+			                                                           MapIndex const end) {
+				for (MapIndex i = begin; i < end; ++i) {
+					Field& f = map[i];
+					f.set_terrain_r(terrain_indices[static_cast<uint8_t>(terrains[2 * i])]);
+					f.set_terrain_d(terrain_indices[static_cast<uint8_t>(terrains[2 * i + 1])]);
+				}
+			});
 		} else {
 			throw UnhandledVersionError("MapTerrainPacket", packet_version, kCurrentPacketVersion);
 		}
@@ -20,6 +20,10 @@
 #include "map_io/widelands_map_loader.h"
 
 #include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/format.hpp>
 
 #include "base/log.h"
 #include "base/scoped_timer.h"
@@ -61,6 +65,35 @@
 
 namespace Widelands {
 
+namespace {
+
+// The big binary files that load_map_complete() is going to read, in reading order.
+std::vector<std::string>
+packet_files(FileSystem& fs, MapLoader::LoadType load_type, PlayerNumber const nr_players) {
+	std::vector<std::string> result = {
+	   "binary/heights", "binary/terrain", "binary/mapobjects", "binary/resource"};
+	// The packets with the game state are skipped when starting a new game
+	if (load_type == MapLoader::LoadType::kScenario) {
+		for (const std::string& filename :
+		     {"binary/node_ownership", "binary/exploration", "binary/flag", "binary/road",
+		      "binary/building", "binary/flag_data", "binary/road_data", "binary/building_data"}) {
+			result.push_back(filename);
+		}
+		for (PlayerNumber p = 1; p <= nr_players; ++p) {
+			const std::string dirname =
+			   (boost::format("player/%u/view") % static_cast<unsigned int>(p)).str();
+			if (fs.is_directory(dirname)) {
+				for (const std::string& filename : fs.list_directory(dirname)) {
+					result.push_back(filename);
+				}
+			}
+		}
+	}
+	return result;
+}
+
+}  // namespace
+
 WidelandsMapLoader::WidelandsMapLoader(FileSystem* fs, Map* const m) : MapLoader("", *m), fs_(fs) {
 	m->filesystem_.reset(fs);
 }
@@ -120,6 +153,10 @@ int32_t WidelandsMapLoader::load_map_complete(EditorGameBase& egbase,
 	map_.set_size(map_.width_, map_.height_);
 	mol_.reset(new MapObjectLoader());
 
+	// Inflate the big packets in the background. Parsing them is mostly parallel
+	// too, only linking the map objects has to happen in order.
+	fs_->prefetch(packet_files(*fs_, load_type, map_.get_nrplayers()));
+
 	// MANDATORY PACKETS
 	// PRELOAD DATA BEGIN
 	log("Reading Elemental Data ... ");
@@ -95,6 +95,9 @@ struct GameClientImpl {
 	/// Backlog of chat messages
 	std::vector<ChatMessage> chatmessages;
 
+	/// The hash function for the syncstream, chosen by the host on launch
+	Widelands::SyncHashType sync_hash_type;
+
 	/** File that is eventually transferred via the network if not found at the other side */
 	std::unique_ptr<NetTransferFile> file_;
 
@@ -241,6 +244,7 @@ GameClient::GameClient(const std::pair<NetAddress, NetAddress>& host,
 	d->realspeed = 0;
 	d->desiredspeed = 1000;
 	d->file_ = nullptr;
+	d->sync_hash_type = Widelands::SyncHashType::kMd5;
 
 	// Get the default win condition script
 	d->settings.win_condition_script = d->settings.win_condition_scripts.front();
@@ -270,6 +274,7 @@ void GameClient::run() {
 
 	Widelands::Game game;
 	game.set_write_syncstream(get_config_bool("write_syncstreams", true));
+	game.set_sync_hash_type(d->sync_hash_type);
 
 	try {
 		std::unique_ptr<UI::ProgressWindow> loader_ui(new UI::ProgressWindow());
@@ -982,12 +987,17 @@ void GameClient::handle_packet(RecvPacket& packet) {
 	case NETCMD_PEACEFUL_MODE:
 		d->settings.peaceful = packet.unsigned_8();
 		break;
-	case NETCMD_LAUNCH:
+	case NETCMD_LAUNCH: {
 		if (!d->modal || d->game) {
 			throw DisconnectException("UNEXPECTED_LAUNCH");
 		}
+		const uint8_t sync_hash_type = packet.unsigned_8();
+		if (sync_hash_type > static_cast<uint8_t>(Widelands::SyncHashType::kXxh64)) {
+			throw ProtocolException(NETCMD_LAUNCH);
+		}
+		d->sync_hash_type = static_cast<Widelands::SyncHashType>(sync_hash_type);
 		d->modal->end_modal<FullscreenMenuBase::MenuTarget>(FullscreenMenuBase::MenuTarget::kOk);
-		break;
+	} break;
 	case NETCMD_SETSPEED:
 		d->realspeed = packet.unsigned_16();
 		log("[Client] speed: %u.%03u\n", d->realspeed / 1000, d->realspeed % 1000);
@@ -627,11 +627,14 @@ void GameHost::run() {
 			disconnect_client(i, "GAME_STARTED_AT_CONNECT");
 	}
 
+	Widelands::Game game;
+
+	// Every client has to hash the syncstream like we do
 	SendPacket packet;
 	packet.unsigned_8(NETCMD_LAUNCH);
+	packet.unsigned_8(static_cast<uint8_t>(game.sync_hash_type()));
 	broadcast(packet);
 
-	Widelands::Game game;
 	game.set_ai_training_mode(get_config_bool("ai_training", false));
 	game.set_auto_speed(get_config_bool("auto_speed", false));
 	game.set_write_syncstream(get_config_bool("write_syncstreams", true));
@@ -28,7 +28,7 @@ enum {
 	 * The current version of the in-game network protocol. Client and host
 	 * protocol versions must match.
 	 */
-	NETWORK_PROTOCOL_VERSION = 23,
+	NETWORK_PROTOCOL_VERSION = 24,
 
 	/**
 	 * The default interval (in milliseconds) in which the host issues
@@ -212,6 +212,8 @@ enum {
 
 	/**
 	 * Sent by the host during game setup to indicate that the game starts.
+	 * The payload is:
+	 * \li unsigned_8: the \ref Widelands::SyncHashType that everybody has to use
 	 *
 	 * The client must load the map and setup the game. As soon as the game
 	 * is fully loaded, it must behave as if a \ref NETCMD_WAIT command had
@@ -248,7 +250,7 @@ enum {
 	NETCMD_WAIT = 14,
 
 	/**
-	 * Sent by the host to request an MD5 synchronization hash. Payload is:
+	 * Sent by the host to request a synchronization hash. Payload is:
 	 * \li signed_32: game time at which the hash must be taken
 	 *
 	 * The client must reply with a \ref NETCMD_SYNCREPORT command as soon
@@ -301,7 +303,7 @@ enum {
 	 * Sent by the client to reply to a \ref NETCMD_SYNCREQUEST command,
 	 * with the following payload:
 	 * \li signed_32: game time at which the hash was taken
-	 * \li 16 bytes:  MD5 hash
+	 * \li 16 bytes:  sync hash, see \ref Widelands::Game::get_sync_hash
 	 *
 	 * It is solely the host's responsibility to act when desyncs are
 	 * detected.
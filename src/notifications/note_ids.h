@@ -43,7 +43,8 @@ enum class NoteId : uint32_t {
 	Sound,
 	Dropdown,
 	GameSettings,
-	MapOptions
+	MapOptions,
+	FieldVision
 };
 
 #endif  // end of include guard: WL_NOTIFICATIONS_NOTE_IDS_H
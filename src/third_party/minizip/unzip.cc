@@ -625,6 +625,33 @@ extern int32_t ZEXPORT unzGoToNextFile(unzFile file) {
 // to cache the directory in memory. The goal being a single
 // comprehensive file read to put the file I need in a memory.
 */
+extern int32_t ZEXPORT unzGetFilePos(unzFile file, unz_file_pos* file_pos) {
+	if (not file || not file_pos)
+		return UNZ_PARAMERROR;
+	unz_s* const s = static_cast<unz_s*>(file);
+	if (!s->current_file_ok)
+		return UNZ_END_OF_LIST_OF_FILE;
+
+	file_pos->pos_in_zip_directory = s->pos_in_central_dir;
+	file_pos->num_of_file = s->num_file;
+	return UNZ_OK;
+}
+
+extern int32_t ZEXPORT unzGoToFilePos(unzFile file, const unz_file_pos* file_pos) {
+	int32_t err;
+
+	if (not file || not file_pos)
+		return UNZ_PARAMERROR;
+	unz_s* const s = static_cast<unz_s*>(file);
+
+	// Jump to the corresponding place in the central directory and read the file info there
+	s->pos_in_central_dir = file_pos->pos_in_zip_directory;
+	s->num_file = file_pos->num_of_file;
+	err = unzlocal_GetCurrentFileInfoInternal(
+	   file, &s->cur_file_info, &s->cur_file_info_internal, nullptr, 0, nullptr, 0, nullptr, 0);
+	s->current_file_ok = (err == UNZ_OK);
+	return err;
+}
 
 /*
 // Unzip Helper Functions - should be here?
@@ -154,6 +154,25 @@ extern int32_t ZEXPORT unzGoToNextFile OF((unzFile file));
   return UNZ_END_OF_LIST_OF_FILE if the actual file was the latest.
 */
 
+/* unz_file_pos remembers the position of a file in the central directory */
+typedef struct unz_file_pos_s {
+	uLong pos_in_zip_directory; /* offset in zip file directory */
+	uLong num_of_file;          /* # of file */
+} unz_file_pos;
+
+extern int32_t ZEXPORT unzGetFilePos OF((unzFile file, unz_file_pos* file_pos));
+/*
+  Store the position of the current file in file_pos.
+  return UNZ_OK if there is no problem
+*/
+
+extern int32_t ZEXPORT unzGoToFilePos OF((unzFile file, const unz_file_pos* file_pos));
+/*
+  Set the current file of the zipfile to the one at file_pos, which must have been
+  obtained with unzGetFilePos from the same zipfile.
+  return UNZ_OK if there is no problem
+*/
+
 /* ****************************************** */
 
 extern int32_t ZEXPORT unzGetCurrentFileInfo OF((unzFile file,
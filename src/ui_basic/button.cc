@@ -123,6 +123,7 @@ void Button::set_pic(const Image* pic) {
 		return;
 
 	title_image_ = pic;
+	invalidate();
 }
 
 /**
@@ -134,6 +135,7 @@ void Button::set_title(const std::string& title) {
 
 	title_image_ = nullptr;
 	title_ = title;
+	invalidate();
 }
 
 /**
@@ -156,6 +158,7 @@ void Button::set_enabled(bool const on) {
 		enabled_ = false;
 		highlighted_ = false;
 	}
+	invalidate();
 }
 
 /**
@@ -352,11 +355,17 @@ bool Button::handle_mousemove(const uint8_t, int32_t, int32_t, int32_t, int32_t)
 }
 
 void Button::set_visual_state(UI::Button::VisualState input_state) {
-	visual_state_ = input_state;
+	if (visual_state_ != input_state) {
+		visual_state_ = input_state;
+		invalidate();
+	}
 }
 
 void Button::set_disable_style(UI::ButtonDisableStyle input_style) {
-	disable_style_ = input_style;
+	if (disable_style_ != input_style) {
+		disable_style_ = input_style;
+		invalidate();
+	}
 }
 
 void Button::set_perm_pressed(bool pressed) {
@@ -365,7 +374,11 @@ void Button::set_perm_pressed(bool pressed) {
 }
 
 void Button::set_style(UI::ButtonStyle bstyle) {
-	style_ = &g_gr->styles().button_style(bstyle);
+	const UI::ButtonStyleInfo* new_style = &g_gr->styles().button_style(bstyle);
+	if (style_ != new_style) {
+		style_ = new_style;
+		invalidate();
+	}
 }
 
 void Button::toggle() {
@@ -379,5 +392,6 @@ void Button::toggle() {
 	case UI::Button::VisualState::kFlat:
 		break;  // Do nothing for flat buttons
 	}
+	invalidate();
 }
 }  // namespace UI
@@ -85,9 +85,12 @@ private:
 	};
 	uint8_t flags_;
 	void set_flags(uint8_t const flags, bool const enable) {
+		const uint8_t old_flags = flags_;
 		flags_ &= ~flags;
 		if (enable)
 			flags_ |= flags;
+		if (flags_ != old_flags)
+			invalidate();
 	}
 	const Image* pic_graphics_;
 	std::shared_ptr<const UI::RenderedText> rendered_text_;
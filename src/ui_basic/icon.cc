@@ -40,7 +40,10 @@ Icon::Icon(Panel* const parent, const Image* picture_id)
 }
 
 void Icon::set_icon(const Image* picture_id) {
-	pic_ = picture_id;
+	if (pic_ != picture_id) {
+		pic_ = picture_id;
+		invalidate();
+	}
 }
 
 void Icon::set_frame(const RGBColor& color) {
@@ -48,10 +51,12 @@ void Icon::set_frame(const RGBColor& color) {
 	framecolor_.r = color.r;
 	framecolor_.g = color.g;
 	framecolor_.b = color.b;
+	invalidate();
 }
 
 void Icon::set_no_frame() {
 	draw_frame_ = false;
+	invalidate();
 }
 
 void Icon::draw(RenderTarget& dst) {
@@ -124,6 +124,7 @@ void BaseListselect::clear() {
 	selection_ = no_selection_index();
 	last_click_time_ = -10000;
 	last_selection_ = no_selection_index();
+	invalidate();
 }
 
 /**
@@ -156,6 +157,7 @@ void BaseListselect::add(const std::string& name,
 	entry_records_.push_back(er);
 
 	layout();
+	invalidate();
 
 	if (sel)
 		select(entry_records_.size() - 1);
@@ -184,6 +186,7 @@ void BaseListselect::sort(const uint32_t Begin, uint32_t End) {
 				entry_records_[j] = eri;
 			}
 		}
+	invalidate();
 }
 
 /**
@@ -194,6 +197,7 @@ void BaseListselect::set_scrollpos(const int32_t i) {
 		return;
 
 	scrollpos_ = i;
+	invalidate();
 }
 
 /**
@@ -211,6 +215,7 @@ void BaseListselect::select(const uint32_t i) {
 		entry_records_[i]->pic = check_pic_;
 	}
 	selection_ = i;
+	invalidate();
 
 	selected(selection_);
 }
@@ -543,6 +548,7 @@ void BaseListselect::remove(const uint32_t i) {
 
 	delete (entry_records_[i]);
 	entry_records_.erase(entry_records_.begin() + i);
+	invalidate();
 	if (selection_ == i)
 		selected(selection_ = no_selection_index());
 	else if (i < selection_)
@@ -121,6 +121,7 @@ void MultilineTextarea::recompute() {
 			break;  // No need to wrap twice.
 		}
 	}
+	invalidate();
 }
 
 /**
@@ -25,6 +25,7 @@
 #include "graphic/rendertarget.h"
 #include "graphic/text/font_set.h"
 #include "graphic/text_layout.h"
+#include "graphic/texture.h"
 #include "sound/sound_handler.h"
 #include "wlapplication.h"
 #include "wlapplication_options.h"
@@ -71,9 +72,11 @@ Panel::Panel(Panel* const nparent,
      desired_w_(nw),
      desired_h_(nh),
      running_(false),
+     render_cache_dirty_(true),
      tooltip_(tooltip_text) {
 	assert(nparent != this);
 	if (parent_) {
+		parent_->invalidate();
 		next_ = parent_->first_child_;
 		prev_ = nullptr;
 		if (next_)
@@ -100,6 +103,7 @@ Panel::~Panel() {
 
 	// Unlink
 	if (parent_) {
+		parent_->invalidate();
 		if (parent_->mousein_child_ == this)
 			parent_->mousein_child_ = nullptr;
 		if (parent_->focus_ == this)
@@ -256,6 +260,7 @@ void Panel::set_size(const int nw, const int nh) {
 	// Make sure that we never get negative width/height in release builds.
 	w_ = std::max(0, nw);
 	h_ = std::max(0, nh);
+	invalidate();
 
 	if (parent_)
 		move_inside_parent();
@@ -269,6 +274,9 @@ void Panel::set_size(const int nw, const int nh) {
 void Panel::set_pos(const Vector2i n) {
 	x_ = n.x;
 	y_ = n.y;
+	if (parent_) {
+		parent_->invalidate();
+	}
 	position_changed();
 }
 
@@ -383,6 +391,7 @@ void Panel::set_border(int l, int r, int t, int b) {
 	rborder_ = r;
 	tborder_ = t;
 	bborder_ = b;
+	invalidate();
 }
 
 int Panel::get_inner_w() const {
@@ -400,6 +409,7 @@ int Panel::get_inner_h() const {
 void Panel::move_to_top() {
 	if (!parent_)
 		return;
+	parent_->invalidate();
 
 	// unlink
 	if (prev_)
@@ -431,6 +441,9 @@ void Panel::set_visible(bool const on) {
 	flags_ &= ~pf_visible;
 	if (on)
 		flags_ |= pf_visible;
+	if (parent_) {
+		parent_->invalidate();
+	}
 }
 
 /**
@@ -469,6 +482,22 @@ void Panel::draw_background(RenderTarget& dst, Recti rect, const UI::PanelStyleI
 	}
 }
 
+void Panel::set_cache_rendering(bool const on) {
+	if (on) {
+		flags_ |= pf_cache_rendering;
+	} else {
+		flags_ &= ~pf_cache_rendering;
+		render_cache_.reset();
+	}
+	invalidate();
+}
+
+void Panel::invalidate() {
+	for (Panel* p = this; p; p = p->parent_) {
+		p->render_cache_dirty_ = true;
+	}
+}
+
 /**
  * Called once per event loop pass, unless set_think(false) has
  * been called. It is intended to be used for animations and game logic.
@@ -766,6 +795,36 @@ void Panel::do_draw_inner(RenderTarget& dst) {
 	draw_overlay(dst);
 }
 
+/**
+ * Draw the inner area into the render cache if it is outdated, then draw the
+ * render cache into 'dst'.
+ */
+void Panel::do_draw_inner_cached(RenderTarget& dst) {
+	const int inner_w = get_inner_w();
+	const int inner_h = get_inner_h();
+	if (inner_w <= 0 || inner_h <= 0) {
+		return;
+	}
+
+	if (render_cache_ == nullptr || render_cache_->width() != inner_w ||
+	    render_cache_->height() != inner_h) {
+		render_cache_.reset(new Texture(inner_w, inner_h));
+		render_cache_dirty_ = true;
+	}
+
+	if (render_cache_dirty_) {
+		// Reset the flag first so that invalidations during drawing are not lost
+		render_cache_dirty_ = false;
+		render_cache_->fill_rect(Rectf(0.f, 0.f, inner_w, inner_h), RGBAColor(0, 0, 0, 0));
+		RenderTarget cache_target(render_cache_.get());
+		do_draw_inner(cache_target);
+	}
+
+	// The panel is opaque, so we do not need to blend the alpha values that
+	// drawing into the cache produced.
+	dst.blit(Vector2i::zero(), render_cache_.get(), BlendMode::Copy);
+}
+
 /**
  * Subset for the border first and draw the border, then subset for the inner
  * area and draw the inner area.
@@ -789,8 +848,13 @@ void Panel::do_draw(RenderTarget& dst) {
 	Recti innerwindow(
 	   Vector2i(lborder_, tborder_), w_ - (lborder_ + rborder_), h_ - (tborder_ + bborder_));
 
-	if (dst.enter_window(innerwindow, nullptr, nullptr))
-		do_draw_inner(dst);
+	if (dst.enter_window(innerwindow, nullptr, nullptr)) {
+		if (flags_ & pf_cache_rendering) {
+			do_draw_inner_cached(dst);
+		} else {
+			do_draw_inner(dst);
+		}
+	}
 
 	dst.set_window(outerrc, outerofs);
 }
@@ -824,6 +888,7 @@ inline Panel* Panel::child_at_mouse_cursor(int32_t const x, int32_t const y, Pan
  * window)
  */
 void Panel::do_mousein(bool const inside) {
+	invalidate();
 	if (!inside && mousein_child_) {
 		mousein_child_->do_mousein(false);
 		mousein_child_ = nullptr;
@@ -837,6 +902,7 @@ void Panel::do_mousein(bool const inside) {
  * Returns whether the event was processed.
  */
 bool Panel::do_mousepress(const uint8_t btn, int32_t x, int32_t y) {
+	invalidate();
 	if (get_can_focus()) {
 		focus();
 	}
@@ -855,6 +921,7 @@ bool Panel::do_mousepress(const uint8_t btn, int32_t x, int32_t y) {
 }
 
 bool Panel::do_mousewheel(uint32_t which, int32_t x, int32_t y, Vector2i rel_mouse_pos) {
+	invalidate();
 	// Check if a child-panel is beneath the mouse and processes the event
 	for (Panel* child = first_child_; child; child = child->next_) {
 		if (!child->handles_mouse() || !child->is_visible()) {
@@ -877,6 +944,7 @@ bool Panel::do_mousewheel(uint32_t which, int32_t x, int32_t y, Vector2i rel_mou
 }
 
 bool Panel::do_mouserelease(const uint8_t btn, int32_t x, int32_t y) {
+	invalidate();
 	x -= lborder_;
 	y -= tborder_;
 	if (mousegrab_ != this)
@@ -889,6 +957,7 @@ bool Panel::do_mouserelease(const uint8_t btn, int32_t x, int32_t y) {
 
 bool Panel::do_mousemove(
    uint8_t const state, int32_t x, int32_t y, int32_t const xdiff, int32_t const ydiff) {
+	invalidate();
 	x -= lborder_;
 	y -= tborder_;
 	if (mousegrab_ != this) {
@@ -907,6 +976,7 @@ bool Panel::do_mousemove(
  * If it doesn't process the key, we'll see if we can use the event.
  */
 bool Panel::do_key(bool const down, SDL_Keysym const code) {
+	invalidate();
 	if (focus_ && focus_->do_key(down, code)) {
 		return true;
 	}
@@ -924,6 +994,7 @@ bool Panel::do_key(bool const down, SDL_Keysym const code) {
 }
 
 bool Panel::do_textinput(const std::string& text) {
+	invalidate();
 	if (focus_ && focus_->do_textinput(text)) {
 		return true;
 	}
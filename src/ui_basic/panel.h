@@ -22,6 +22,7 @@
 
 #include <cassert>
 #include <cstring>
+#include <memory>
 #include <string>
 
 #include <SDL_keyboard.h>
@@ -38,6 +39,7 @@
 
 class RenderTarget;
 class Image;
+class Texture;
 
 namespace UI {
 
@@ -81,6 +83,8 @@ public:
 		pf_handle_textinput = 1024,
 		/// whether widget and its children will handle any key presses
 		pf_handle_keypresses = 2048,
+		/// whether the inner area is rendered into a texture that is reused for later frames
+		pf_cache_rendering = 4096,
 	};
 
 	Panel(Panel* const nparent,
@@ -231,6 +235,19 @@ public:
 	virtual void draw_border(RenderTarget&);
 	virtual void draw_overlay(RenderTarget&);
 
+	// Renders the inner area into a texture and reuses it in later frames
+	// until the panel or one of its children is invalidated. Only use this for
+	// panels whose draw() covers the whole inner area with opaque pixels, whose
+	// children only draw through their RenderTarget, i.e. no map views, and
+	// whose children invalidate themselves when their content changes.
+	void set_cache_rendering(bool on);
+
+	// Marks the cached rendering of this panel and of all panels containing it
+	// as outdated. Input events, changes to the geometry and visibility and
+	// adding or removing children do this automatically. Panels whose content
+	// changes otherwise, e.g. in think(), have to call this themselves.
+	void invalidate();
+
 	// Events
 	virtual void think();
 
@@ -356,6 +373,7 @@ private:
 
 	void do_draw(RenderTarget&);
 	void do_draw_inner(RenderTarget&);
+	void do_draw_inner_cached(RenderTarget&);
 	void do_think();
 
 	Panel* child_at_mouse_cursor(int32_t mouse_x, int32_t mouse_y, Panel* child);
@@ -401,6 +419,10 @@ private:
 	bool running_;
 	int return_code_;
 
+	// The inner area rendered in an earlier frame, see set_cache_rendering().
+	std::unique_ptr<Texture> render_cache_;
+	bool render_cache_dirty_;
+
 	std::string tooltip_;
 	static Panel* modal_;
 	static Panel* mousegrab_;
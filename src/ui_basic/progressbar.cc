@@ -49,7 +49,10 @@ ProgressBar::ProgressBar(Panel* const parent,
  * Set the current state of progress.
  */
 void ProgressBar::set_state(uint32_t state) {
-	state_ = state;
+	if (state_ != state) {
+		state_ = state;
+		invalidate();
+	}
 }
 
 /**
@@ -57,7 +60,10 @@ void ProgressBar::set_state(uint32_t state) {
  */
 void ProgressBar::set_total(uint32_t total) {
 	assert(total);
-	total_ = total;
+	if (total_ != total) {
+		total_ = total;
+		invalidate();
+	}
 }
 
 /**
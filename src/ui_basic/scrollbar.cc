@@ -126,6 +126,7 @@ void Scrollbar::set_scrollpos(int32_t pos) {
 		return;
 
 	pos_ = pos;
+	invalidate();
 	moved(pos);
 }
 
@@ -516,6 +517,7 @@ void Scrollbar::layout() {
 	} else {
 		buttonsize_ = kSize;
 	}
+	invalidate();
 }
 
 }  // namespace UI
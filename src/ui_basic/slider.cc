@@ -102,6 +102,7 @@ void Slider::calculate_cursor_position() {
 	} else {
 		cursor_pos_ = (value_ - min_value_) * get_bar_size() / (max_value_ - min_value_);
 	}
+	invalidate();
 }
 
 void Slider::layout() {
@@ -211,6 +212,7 @@ void Slider::set_enabled(const bool enabled) {
 		highlighted_ = false;
 		grab_mouse(false);
 	}
+	invalidate();
 }
 
 /**
@@ -221,6 +223,7 @@ void Slider::set_highlighted(bool highlighted) {
 		return;
 
 	highlighted_ = highlighted;
+	invalidate();
 }
 
 /**
@@ -535,6 +538,7 @@ void DiscreteSlider::set_labels(const std::vector<std::string> labels_in) {
 	labels = labels_in;
 	slider.set_max_value(labels_in.size() - 1);
 	layout();
+	invalidate();
 }
 
 void DiscreteSlider::layout() {
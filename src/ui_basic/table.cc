@@ -197,6 +197,7 @@ void Table<void*>::clear_selections() {
 	multiselect_.clear();
 	selection_ = no_selection_index();
 	last_selection_ = no_selection_index();
+	invalidate();
 }
 
 uint32_t Table<void*>::get_eff_w() const {
@@ -462,6 +463,7 @@ void Table<void*>::select(const uint32_t i) {
 		multiselect_.insert(selection_);
 		last_multiselect_ = selection_;
 	}
+	invalidate();
 
 	selected(selection_);
 }
@@ -470,6 +472,7 @@ void Table<void*>::select(const uint32_t i) {
  * If 'force' is true, adds the given 'row' to the selection, ignoring everything else.
  */
 void Table<void*>::multiselect(uint32_t row, bool force) {
+	invalidate();
 	if (force) {
 		select(row);
 		return;
@@ -547,7 +550,7 @@ uint32_t Table<void*>::toggle_entry(uint32_t row) {
  * Add a new entry to the table.
  */
 Table<void*>::EntryRecord& Table<void*>::add(void* const entry, const bool do_select) {
-	EntryRecord& result = *new EntryRecord(entry);
+	EntryRecord& result = *new EntryRecord(this, entry);
 	entry_records_.push_back(&result);
 	result.data_.resize(columns_.size());
 
@@ -556,6 +559,7 @@ Table<void*>::EntryRecord& Table<void*>::add(void* const entry, const bool do_se
 		scrollbar_->set_scrollpos(std::numeric_limits<int32_t>::max());
 	}
 	layout();
+	invalidate();
 	return result;
 }
 
@@ -564,6 +568,7 @@ Table<void*>::EntryRecord& Table<void*>::add(void* const entry, const bool do_se
  */
 void Table<void*>::set_scrollpos(int32_t const i) {
 	scrollpos_ = i;
+	invalidate();
 }
 
 void Table<void*>::scroll_to_top() {
@@ -592,6 +597,7 @@ void Table<void*>::remove(const uint32_t i) {
 		last_multiselect_ = selection_;
 	}
 	layout();
+	invalidate();
 }
 
 /**
@@ -717,6 +723,7 @@ void Table<void*>::sort(const uint32_t lower_bound, uint32_t upper_bound) {
 			multiselect_.insert(entry);
 		}
 	}
+	invalidate();
 }
 
 bool Table<void*>::default_compare_string(uint32_t column, uint32_t a, uint32_t b) {
@@ -725,8 +732,8 @@ bool Table<void*>::default_compare_string(uint32_t column, uint32_t a, uint32_t
 	return ea.get_string(column) < eb.get_string(column);
 }
 
-Table<void*>::EntryRecord::EntryRecord(void* const e)
-   : entry_(e), font_style_(nullptr), disabled_(false) {
+Table<void*>::EntryRecord::EntryRecord(Table<void*>* const table, void* const e)
+   : table_(table), entry_(e), font_style_(nullptr), disabled_(false) {
 }
 
 void Table<void*>::EntryRecord::set_picture(uint8_t const col,
@@ -734,14 +741,22 @@ void Table<void*>::EntryRecord::set_picture(uint8_t const col,
                                             const std::string& str) {
 	assert(col < data_.size());
 
-	data_.at(col).d_picture = pic;
-	data_.at(col).d_string = str;
+	Data& data = data_.at(col);
+	if (data.d_picture != pic || data.d_string != str) {
+		data.d_picture = pic;
+		data.d_string = str;
+		table_->invalidate();
+	}
 }
 void Table<void*>::EntryRecord::set_string(uint8_t const col, const std::string& str) {
 	assert(col < data_.size());
 
-	data_.at(col).d_picture = nullptr;
-	data_.at(col).d_string = str;
+	Data& data = data_.at(col);
+	if (data.d_picture != nullptr || data.d_string != str) {
+		data.d_picture = nullptr;
+		data.d_string = str;
+		table_->invalidate();
+	}
 }
 const Image* Table<void*>::EntryRecord::get_picture(uint8_t const col) const {
 	assert(col < data_.size());
@@ -130,7 +130,7 @@ public:
 template <> class Table<void*> : public Panel {
 public:
 	struct EntryRecord {
-		explicit EntryRecord(void* entry);
+		EntryRecord(Table<void*>* table, void* entry);
 
 		/// Text conventions: Title Case for the 'str'
 		void set_picture(uint8_t col, const Image* pic, const std::string& str = std::string());
@@ -143,7 +143,10 @@ public:
 		}
 
 		void set_font_style(const UI::FontStyleInfo& style) {
-			font_style_ = &style;
+			if (font_style_ != &style) {
+				font_style_ = &style;
+				table_->invalidate();
+			}
 		}
 
 		const UI::FontStyleInfo* font_style() const {
@@ -154,11 +157,15 @@ public:
 			return disabled_;
 		}
 		void set_disabled(bool disable) {
-			disabled_ = disable;
+			if (disabled_ != disable) {
+				disabled_ = disable;
+				table_->invalidate();
+			}
 		}
 
 	private:
 		friend class Table<void*>;
+		Table<void*>* table_;  ///< invalidated when the record changes
 		void* entry_;
 		const UI::FontStyleInfo* font_style_;
 		struct Data {
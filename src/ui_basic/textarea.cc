@@ -88,6 +88,7 @@ void Textarea::update() {
 	} else if (layoutmode_ == LayoutMode::Layouted) {
 		update_desired_size();
 	}
+	invalidate();
 }
 
 /**
@@ -799,6 +799,7 @@ bool WLApplication::init_settings() {
 	get_config_int("panel_snap_distance", 0);
 	get_config_int("autosave", 0);
 	get_config_int("rolling_autosave", 0);
+	get_config_bool("background_autosave", false);
 	// Undocumented on command line, appears in game options
 	get_config_bool("single_watchwin", false);
 	get_config_bool("auto_roadbuild_mode", false);
@@ -78,6 +78,10 @@ void show_usage(const std::string& build_id, const std::string& build_type) {
 	          << _(" --rolling_autosave=[...]\n"
 	               "                      Use this many files for rolling autosaves")
 	          << endl
+	          << _(" --background_autosave=[true|false]\n"
+	               "                      Write autosaves on a background thread.\n"
+	               "                      Default is true.")
+	          << endl
 	          << _(" --metaserver=[...]\n"
 	               "                      Connect to a different metaserver for internet gaming.")
 	          << endl
@@ -120,6 +120,7 @@ BuildingStatisticsMenu::BuildingStatisticsMenu(InteractivePlayer& parent,
      low_production_(33),
      has_selection_(false),
      nr_building_types_(parent.egbase().tribes().nrbuildings()) {
+	set_cache_rendering(true);
 
 	building_buttons_ = std::vector<UI::Button*>(nr_building_types_);
 	owned_labels_ = std::vector<UI::Textarea*>(nr_building_types_);
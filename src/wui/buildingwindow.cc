@@ -59,6 +59,7 @@ BuildingWindow::BuildingWindow(InteractiveGameBase& parent,
      showing_workarea_(false),
      avoid_fastclick_(avoid_fastclick),
      expeditionbtn_(nullptr) {
+	set_cache_rendering(true);
 	buildingnotes_subscriber_ = Notifications::subscribe<Widelands::NoteBuilding>(
 	   [this](const Widelands::NoteBuilding& note) { on_building_note(note); });
 }
@@ -82,6 +83,7 @@ void BuildingWindow::on_building_note(const Widelands::NoteBuilding& note) {
 		case Widelands::NoteBuilding::Action::kChanged:
 			if (!is_dying_) {
 				init(true, showing_workarea_);
+				invalidate();
 			}
 			break;
 		// The building is no more. Next think() will call die().
@@ -89,6 +89,15 @@ void ConstructionSiteWindow::FakeWaresDisplay::draw_ware(RenderTarget& dst,
 	dst.blit(ware_position(ware), pic);
 }
 
+std::string
+ConstructionSiteWindow::FakeWaresDisplay::ware_draw_state(Widelands::DescriptionIndex ware) {
+	const auto& map =
+	   get_type() == Widelands::wwWARE ? settings_.ware_preferences : settings_.worker_preferences;
+	const auto it = map.find(ware);
+	return WaresDisplay::ware_draw_state(ware) +
+	       (it == map.end() ? "" : std::to_string(static_cast<int>(it->second)));
+}
+
 ConstructionSiteWindow::ConstructionSiteWindow(InteractiveGameBase& parent,
                                                UI::UniqueWindow::Registry& reg,
                                                Widelands::ConstructionSite& cs,
@@ -58,6 +58,7 @@ private:
 
 	protected:
 		void draw_ware(RenderTarget& dst, Widelands::DescriptionIndex ware) override;
+		std::string ware_draw_state(Widelands::DescriptionIndex ware) override;
 
 	private:
 		Widelands::WarehouseSettings& settings_;
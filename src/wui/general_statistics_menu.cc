@@ -58,6 +58,7 @@ GeneralStatisticsMenu::GeneralStatisticsMenu(InteractiveGameBase& parent,
            Widelands::kStatisticsSampleTime,
            WuiPlotArea::Plotmode::kAbsolute),
      selected_information_(0) {
+	set_cache_rendering(true);
 	assert(my_registry_);
 
 	selected_information_ = my_registry_->selected_information;
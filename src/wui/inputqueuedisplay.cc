@@ -56,6 +56,8 @@ InputQueueDisplay::InputQueueDisplay(UI::Panel* const parent,
      max_fill_indicator_(g_gr->images().get(pic_max_fill_indicator)),
      cache_size_(queue.get_max_size()),
      cache_max_fill_(queue.get_max_fill()),
+     cache_filled_(queue.get_filled()),
+     cache_missing_(queue.get_missing()),
      total_height_(0),
      show_only_(show_only) {
 	if (type_ == Widelands::wwWARE) {
@@ -101,6 +103,8 @@ InputQueueDisplay::InputQueueDisplay(UI::Panel* const parent,
      index_(di),
      type_(ww),
      max_fill_indicator_(g_gr->images().get(pic_max_fill_indicator)),
+     cache_filled_(0),
+     cache_missing_(0),
      total_height_(0),
      show_only_(show_only) {
 	cache_size_ = check_max_size();
@@ -193,6 +197,14 @@ void InputQueueDisplay::think() {
 	if (static_cast<uint32_t>(check_max_fill()) != cache_max_fill_) {
 		cache_max_fill_ = check_max_fill();
 		compute_max_fill_buttons_enabled_state();
+		invalidate();
+	}
+
+	if (queue_ &&
+	    (queue_->get_filled() != cache_filled_ || queue_->get_missing() != cache_missing_)) {
+		cache_filled_ = queue_->get_filled();
+		cache_missing_ = queue_->get_missing();
+		invalidate();
 	}
 }
 
@@ -100,7 +100,7 @@ public:
 	void hide_workarea(const Widelands::Coords& coords, bool is_additional);
 
 	bool has_expedition_port_space(const Widelands::Coords&) const;
-	std::map<Widelands::Ship*, Widelands::Coords>& get_expedition_port_spaces() {
+	std::map<Widelands::OPtr<Widelands::Ship>, Widelands::Coords>& get_expedition_port_spaces() {
 		return expedition_port_spaces_;
 	}
 
@@ -345,7 +345,7 @@ private:
 	std::unordered_set<std::unique_ptr<WorkareaPreview>> workarea_previews_;
 	std::unique_ptr<Workareas> workareas_cache_;
 
-	std::map<Widelands::Ship*, Widelands::Coords> expedition_port_spaces_;
+	std::map<Widelands::OPtr<Widelands::Ship>, Widelands::Coords> expedition_port_spaces_;
 
 	RoadBuildingOverlays road_building_overlays_;
 
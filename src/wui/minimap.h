@@ -84,9 +84,9 @@ private:
 		Rectf view_area_;
 		const Image* pic_map_spot_;
 
-		// This needs to be owned since it will be rendered by the RenderQueue
-		// later, so it must be valid for the whole frame.
-		std::unique_ptr<Texture> minimap_image_;
+		// Owns the texture that is blitted, which is rendered by the RenderQueue
+		// later, so it stays valid for the whole frame.
+		MiniMapCache minimap_cache_;
 
 	public:
 		MiniMapLayer* minimap_layers_;
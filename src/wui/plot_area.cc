@@ -410,6 +410,7 @@ void WuiPlotArea::think() {
 	if (needs_update_ || (gametime - lastupdate_) > kUpdateTimeInGametimeMs) {
 		update();
 		lastupdate_ = gametime;
+		invalidate();
 	}
 	needs_update_ = false;
 }
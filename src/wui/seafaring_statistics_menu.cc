@@ -132,6 +132,7 @@ SeafaringStatisticsMenu::SeafaringStatisticsMenu(InteractivePlayer& plr,
                        _("Center the map on the selected ship"),
                        "g")),
      table_(&main_box_, 0, 0, get_inner_w() - 2 * kPadding, 100, UI::PanelStyle::kWui) {
+	set_cache_rendering(true);
 
 	const Widelands::TribeDescr& tribe = iplayer().player().tribe();
 	colony_icon_ = tribe.get_worker_descr(tribe.builder())->icon();
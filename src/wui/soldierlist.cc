@@ -102,6 +102,9 @@ private:
 
 	std::vector<Icon> icons_;
 
+	// The capacity that the black background was last drawn for
+	uint32_t cache_capacity_;
+
 	uint32_t rows_;
 	uint32_t cols_;
 
@@ -117,6 +120,7 @@ SoldierPanel::SoldierPanel(UI::Panel& parent,
    : Panel(&parent, 0, 0, 0, 0),
      egbase_(gegbase),
      soldier_control_(building.soldier_control()),
+     cache_capacity_(soldier_control_->soldier_capacity()),
      last_animate_time_(0) {
 	assert(soldier_control_ != nullptr);
 	Soldier::calc_info_icon_size(building.owner().tribe(), icon_width_, icon_height_);
@@ -173,6 +177,10 @@ void SoldierPanel::set_click(const SoldierPanel::SoldierFn& fn) {
 void SoldierPanel::think() {
 	bool changes = false;
 	uint32_t capacity = soldier_control_->soldier_capacity();
+	if (capacity != cache_capacity_) {
+		cache_capacity_ = capacity;
+		invalidate();
+	}
 
 	// Update soldier list and target row/col:
 	std::vector<Soldier*> soldierlist = soldier_control_->present_soldiers();
@@ -270,6 +278,7 @@ void SoldierPanel::think() {
 	}
 
 	if (changes) {
+		invalidate();
 		Vector2i mousepos = get_mouse_position();
 		mouseover_fn_(find_soldier(mousepos.x, mousepos.y));
 	}
@@ -107,6 +107,7 @@ WareStatisticsMenu::WareStatisticsMenu(InteractivePlayer& parent,
      tab_panel_(nullptr),
      display_(nullptr),
      slider_(nullptr) {
+	set_cache_rendering(true);
 	uint8_t const nr_wares = parent.get_player()->egbase().tribes().nrwares();
 
 	// Init color sets
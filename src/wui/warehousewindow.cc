@@ -50,6 +50,7 @@ public:
 
 protected:
 	void draw_ware(RenderTarget& dst, Widelands::DescriptionIndex ware) override;
+	std::string ware_draw_state(Widelands::DescriptionIndex ware) override;
 
 private:
 	Widelands::Warehouse& warehouse_;
@@ -96,6 +97,11 @@ void WarehouseWaresDisplay::draw_ware(RenderTarget& dst, Widelands::DescriptionI
 	dst.blit(ware_position(ware), pic);
 }
 
+std::string WarehouseWaresDisplay::ware_draw_state(Widelands::DescriptionIndex ware) {
+	return WaresDisplay::ware_draw_state(ware) +
+	       std::to_string(static_cast<int>(warehouse_.get_stock_policy(get_type(), ware)));
+}
+
 /**
  * Wraps the wares display together with some buttons
  */
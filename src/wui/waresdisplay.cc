@@ -170,6 +170,7 @@ bool AbstractWaresDisplay::handle_mousepress(uint8_t btn, int32_t x, int32_t y)
 			// multiple ware by dragging.
 			selection_anchor_ = ware;
 			in_selection_[ware] = true;
+			invalidate();
 		} else {
 			// A mouse release has been missed
 		}
@@ -201,9 +202,24 @@ bool AbstractWaresDisplay::handle_mouserelease(uint8_t btn, int32_t x, int32_t y
 	for (auto& resetme : in_selection_) {
 		in_selection_[resetme.first] = false;
 	}
+	invalidate();
 	return true;
 }
 
+void AbstractWaresDisplay::think() {
+	std::vector<std::string> state;
+	state.reserve(indices_.size());
+	for (const Widelands::DescriptionIndex& index : indices_) {
+		if (!hidden_[index]) {
+			state.push_back(ware_draw_state(index));
+		}
+	}
+	if (state != draw_state_) {
+		draw_state_.swap(state);
+		invalidate();
+	}
+}
+
 /**
  * Returns the index of the ware under the given coordinates, or
  * DescriptionIndex::null() if the given point is outside the range.
@@ -318,6 +334,7 @@ void AbstractWaresDisplay::update_anchor_selection(int32_t x, int32_t y) {
 			}
 		}
 	}
+	invalidate();
 }
 
 void AbstractWaresDisplay::layout() {
@@ -441,6 +458,7 @@ void AbstractWaresDisplay::select_ware(Widelands::DescriptionIndex ware) {
 		return;
 
 	selected_[ware] = true;
+	invalidate();
 	if (callback_function_)
 		callback_function_(ware, true);
 }
@@ -450,6 +468,7 @@ void AbstractWaresDisplay::unselect_ware(Widelands::DescriptionIndex ware) {
 		return;
 
 	selected_[ware] = false;
+	invalidate();
 	if (callback_function_)
 		callback_function_(ware, false);
 }
@@ -463,6 +482,7 @@ void AbstractWaresDisplay::hide_ware(Widelands::DescriptionIndex ware) {
 	if (hidden_[ware])
 		return;
 	hidden_[ware] = true;
+	invalidate();
 }
 
 bool AbstractWaresDisplay::is_ware_hidden(Widelands::DescriptionIndex ware) const {
@@ -482,6 +502,10 @@ RGBColor AbstractWaresDisplay::info_color_for_ware(Widelands::DescriptionIndex /
 	return g_gr->styles().ware_info_style(UI::WareInfoStyle::kNormal).info_background();
 }
 
+std::string AbstractWaresDisplay::ware_draw_state(Widelands::DescriptionIndex ware) {
+	return info_color_for_ware(ware).hex_value() + info_for_ware(ware);
+}
+
 WaresDisplay::~WaresDisplay() {
 	remove_all_warelists();
 }
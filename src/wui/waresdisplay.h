@@ -65,6 +65,7 @@ public:
 	handle_mousemove(uint8_t state, int32_t x, int32_t y, int32_t xdiff, int32_t ydiff) override;
 	bool handle_mousepress(uint8_t btn, int32_t x, int32_t y) override;
 	bool handle_mouserelease(uint8_t btn, int32_t x, int32_t y) override;
+	void think() override;
 
 	// Wares may be selected (highlighted)
 	void select_ware(Widelands::DescriptionIndex);
@@ -113,6 +114,10 @@ protected:
 
 	virtual RGBColor info_color_for_ware(Widelands::DescriptionIndex);
 
+	/// Everything apart from the selection that the drawing of 'ware' depends on.
+	/// think() redraws the panel whenever this changes for a visible ware.
+	virtual std::string ware_draw_state(Widelands::DescriptionIndex ware);
+
 	const Widelands::TribeDescr::WaresOrder& icons_order() const;
 	virtual Vector2i ware_position(Widelands::DescriptionIndex) const;
 	void draw(RenderTarget&) override;
@@ -146,6 +151,9 @@ private:
 
 	WaresOrderCoords order_coords_;
 
+	// The ware_draw_state() of all visible wares as of the last think()
+	std::vector<std::string> draw_state_;
+
 	void relayout_icons_order_coords();
 	void recalc_desired_size(bool);
 